@@ -55,16 +55,29 @@
 #define AudioNoInterrupts() (NVIC_DISABLE_IRQ(IRQ_SOFTWARE))
 #define AudioInterrupts()   (NVIC_ENABLE_IRQ(IRQ_SOFTWARE))
 
+// No audio is processed between AudioNoInterrupts() and AudioInterrupts(),
+// so they must be close together, or the output will glitch.  To make
+// changes together without stopping the audio, record them with an
+// AudioTransaction and commit() them, see utility/transaction.h.
+
 // include all the library headers, so a sketch can use a single
 // #include <Audio.h> to get the whole library
 //
+#include "AudioStream_F32.h"
+#include "utility/inplace.h"
+#include "utility/event_queue.h"
+#include "utility/transaction.h"
+#include "utility/memory_account.h"
+#include "utility/secondary_pool.h"
 #include "analyze_fft256.h"
 #include "analyze_fft1024.h"
 #include "analyze_print.h"
 #include "analyze_tonedetect.h"
 #include "analyze_notefreq.h"
 #include "analyze_peak.h"
+#include "analyze_peak_f32.h"
 #include "analyze_rms.h"
+#include "analyze_rms_f32.h"
 #include "async_input_spdif3.h"
 #include "control_sgtl5000.h"
 #include "control_wm8731.h"
@@ -72,6 +85,7 @@
 #include "control_cs4272.h"
 #include "control_cs42448.h"
 #include "control_tlv320aic3206.h"
+#include "convert_f32.h"
 #include "effect_bitcrusher.h"
 #include "effect_chorus.h"
 #include "effect_fade.h"
@@ -80,6 +94,7 @@
 #include "effect_multiply.h"
 #include "effect_delay.h"
 #include "effect_delay_ext.h"
+#include "effect_delay_f32.h"
 #include "effect_midside.h"
 #include "effect_reverb.h"
 #include "effect_freeverb.h"
@@ -88,10 +103,15 @@
 #include "effect_combine.h"
 #include "effect_rectifier.h"
 #include "effect_wavefolder.h"
+#include "effect_dynamics.h"
 #include "filter_biquad.h"
+#include "filter_biquad_f32.h"
 #include "filter_fir.h"
+#include "filter_fir_f32.h"
 #include "filter_variable.h"
 #include "filter_ladder.h"
+#include "filter_crossover.h"
+#include "filter_decimate.h"
 #include "input_adc.h"
 #include "input_adcs.h"
 #include "input_i2s.h"
@@ -99,12 +119,16 @@
 #include "input_i2s_quad.h"
 #include "input_i2s_hex.h"
 #include "input_i2s_oct.h"
+#include "input_i2s32.h"
 #include "input_tdm.h"
 #include "input_tdm2.h"
+#include "input_tdm32.h"
 #include "input_pdm.h"
 #include "input_pdm_i2s2.h"
 #include "input_spdif3.h"
 #include "mixer.h"
+#include "mixer_modmatrix.h"
+#include "mixer_f32.h"
 #include "output_dac.h"
 #include "output_dacs.h"
 #include "output_i2s.h"
@@ -112,6 +136,7 @@
 #include "output_i2s_quad.h"
 #include "output_i2s_hex.h"
 #include "output_i2s_oct.h"
+#include "output_i2s32.h"
 #include "output_mqs.h"
 #include "output_pwm.h"
 #include "output_spdif.h"
@@ -121,13 +146,17 @@
 #include "output_pt8211_2.h"
 #include "output_tdm.h"
 #include "output_tdm2.h"
+#include "output_tdm32.h"
 #include "output_adat.h"
 #include "play_memory.h"
+#include "play_memory_poly.h"
+#include "play_midi.h"
 #include "play_queue.h"
 #include "play_sd_raw.h"
 #include "play_sd_wav.h"
 #include "play_serialflash_raw.h"
 #include "record_queue.h"
+#include "record_sd_wav.h"
 #include "synth_tonesweep.h"
 #include "synth_sine.h"
 #include "synth_waveform.h"
@@ -138,5 +167,6 @@
 #include "synth_simple_drum.h"
 #include "synth_pwm.h"
 #include "synth_wavetable.h"
+#include "synth_modulator.h"
 
 #endif
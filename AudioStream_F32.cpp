@@ -0,0 +1,191 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+
+audio_block_f32_t * AudioStream_F32::memory_pool_f32 = NULL;
+uint32_t AudioStream_F32::memory_pool_available_mask_f32[AUDIO_MEMORY_F32_MAX/32];
+uint16_t AudioStream_F32::f32_memory_used = 0;
+uint16_t AudioStream_F32::f32_memory_used_max = 0;
+
+void AudioStream_F32::initialize_f32_memory(audio_block_f32_t *data, unsigned int num)
+{
+	unsigned int i;
+
+	if (num > AUDIO_MEMORY_F32_MAX) num = AUDIO_MEMORY_F32_MAX;
+	__disable_irq();
+	memory_pool_f32 = data;
+	for (i=0; i < AUDIO_MEMORY_F32_MAX/32; i++) {
+		memory_pool_available_mask_f32[i] = 0;
+	}
+	for (i=0; i < num; i++) {
+		memory_pool_available_mask_f32[i >> 5] |= (0x80000000 >> (i & 31));
+		data[i].memory_pool_index = i;
+	}
+	f32_memory_used = 0;
+	f32_memory_used_max = 0;
+	__enable_irq();
+}
+
+audio_block_f32_t * AudioStream_F32::allocate_f32(void)
+{
+	uint32_t *p, *end, avail, n;
+	audio_block_f32_t *block;
+	uint16_t used;
+
+	p = memory_pool_available_mask_f32;
+	end = p + AUDIO_MEMORY_F32_MAX/32;
+	__disable_irq();
+	do {
+		avail = *p;
+		if (avail) break;
+		p++;
+	} while (p < end);
+	if (!avail) {
+		__enable_irq();
+		return NULL;
+	}
+	n = __builtin_clz(avail);
+	*p = avail & ~(0x80000000 >> n);
+	used = f32_memory_used + 1;
+	f32_memory_used = used;
+	__enable_irq();
+	block = memory_pool_f32 + (((p - memory_pool_available_mask_f32) << 5) + n);
+	block->ref_count = 1;
+	if (used > f32_memory_used_max) f32_memory_used_max = used;
+	return block;
+}
+
+void AudioStream_F32::release(audio_block_f32_t *block)
+{
+	uint32_t mask = 0x80000000 >> (block->memory_pool_index & 31);
+	uint32_t index = block->memory_pool_index >> 5;
+
+	__disable_irq();
+	if (block->ref_count > 1) {
+		block->ref_count--;
+	} else {
+		memory_pool_available_mask_f32[index] |= mask;
+		f32_memory_used--;
+	}
+	__enable_irq();
+}
+
+void AudioStream_F32::transmit(audio_block_f32_t *block, unsigned char index)
+{
+	AudioConnection_F32 *c;
+
+	for (c = destination_list_f32; c != NULL; c = c->next_dest) {
+		if (c->src_index == index) {
+			if (c->dst.inputQueue_f32[c->dest_index] == NULL) {
+				c->dst.inputQueue_f32[c->dest_index] = block;
+				block->ref_count++;
+			}
+		}
+	}
+}
+
+audio_block_f32_t * AudioStream_F32::receiveReadOnly_f32(unsigned int index)
+{
+	audio_block_f32_t *in;
+
+	if (index >= num_inputs_f32) return NULL;
+	in = inputQueue_f32[index];
+	inputQueue_f32[index] = NULL;
+	return in;
+}
+
+audio_block_f32_t * AudioStream_F32::receiveWritable_f32(unsigned int index)
+{
+	audio_block_f32_t *in, *p;
+
+	if (index >= num_inputs_f32) return NULL;
+	in = inputQueue_f32[index];
+	inputQueue_f32[index] = NULL;
+	if (in && in->ref_count > 1) {
+		p = allocate_f32();
+		if (p) memcpy(p->data, in->data, sizeof(p->data));
+		in->ref_count--;
+		in = p;
+	}
+	return in;
+}
+
+int AudioConnection_F32::connect(void)
+{
+	AudioConnection_F32 *p;
+
+	if (isConnected) return 0;
+	if (dest_index >= dst.num_inputs_f32) return 2;
+	__disable_irq();
+	p = src.destination_list_f32;
+	if (p == NULL) {
+		src.destination_list_f32 = this;
+	} else {
+		while (p->next_dest) {
+			if (&p->src == &this->src && &p->dst == &this->dst
+			  && p->src_index == this->src_index
+			  && p->dest_index == this->dest_index) {
+				// same connection already exists
+				__enable_irq();
+				return 4;
+			}
+			p = p->next_dest;
+		}
+		p->next_dest = this;
+	}
+	this->next_dest = NULL;
+	src.active = true;
+	dst.active = true;
+	isConnected = true;
+	__enable_irq();
+	return 0;
+}
+
+int AudioConnection_F32::disconnect(void)
+{
+	AudioConnection_F32 *p;
+	audio_block_f32_t *block = NULL;
+
+	if (!isConnected) return 1;
+	__disable_irq();
+	p = src.destination_list_f32;
+	if (p == this) {
+		src.destination_list_f32 = next_dest;
+	} else {
+		while (p && p->next_dest != this) p = p->next_dest;
+		if (p) p->next_dest = next_dest;
+	}
+	// release any block waiting at the destination's input
+	block = dst.inputQueue_f32[dest_index];
+	dst.inputQueue_f32[dest_index] = NULL;
+	isConnected = false;
+	next_dest = NULL;
+	__enable_irq();
+	if (block) AudioStream_F32::release(block);
+	return 0;
+}
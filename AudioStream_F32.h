@@ -0,0 +1,118 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef AudioStream_F32_h_
+#define AudioStream_F32_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+
+// Floating point audio blocks, for signals which need more than 16 bits
+// of resolution.  Samples are -1.0 to +1.0 full scale.  These use their
+// own memory pool, allocated with AudioMemory_F32(), and their own
+// connections, AudioConnection_F32.  Objects using them are updated
+// together with all other audio objects, in the same order.
+
+typedef struct audio_block_f32_struct {
+	uint8_t  ref_count;
+	uint8_t  reserved1;
+	uint16_t memory_pool_index;
+	float    data[AUDIO_BLOCK_SAMPLES];
+} audio_block_f32_t;
+
+#define AUDIO_MEMORY_F32_MAX  256
+
+#define AudioMemory_F32(num) ({ \
+	static DMAMEM audio_block_f32_t data_f32[num]; \
+	AudioStream_F32::initialize_f32_memory(data_f32, num); \
+})
+
+#define AudioMemoryUsage_F32() (AudioStream_F32::f32_memory_used)
+#define AudioMemoryUsageMax_F32() (AudioStream_F32::f32_memory_used_max)
+#define AudioMemoryUsageMaxReset_F32() (AudioStream_F32::f32_memory_used_max = AudioStream_F32::f32_memory_used)
+
+class AudioStream_F32;
+
+class AudioConnection_F32
+{
+public:
+	AudioConnection_F32(AudioStream_F32 &source, AudioStream_F32 &destination) :
+		src(source), dst(destination), src_index(0), dest_index(0),
+		next_dest(NULL), isConnected(false)
+		{ connect(); }
+	AudioConnection_F32(AudioStream_F32 &source, unsigned char sourceOutput,
+		AudioStream_F32 &destination, unsigned char destinationInput) :
+		src(source), dst(destination),
+		src_index(sourceOutput), dest_index(destinationInput),
+		next_dest(NULL), isConnected(false)
+		{ connect(); }
+	~AudioConnection_F32() {
+		disconnect();
+	}
+	int connect(void);
+	int disconnect(void);
+	friend class AudioStream_F32;
+protected:
+	AudioStream_F32 &src;
+	AudioStream_F32 &dst;
+	unsigned char src_index;
+	unsigned char dest_index;
+	AudioConnection_F32 *next_dest;
+	bool isConnected;
+};
+
+class AudioStream_F32 : public AudioStream
+{
+public:
+	AudioStream_F32(unsigned char ninput, audio_block_t **iqueue,
+	  unsigned char ninput_f32, audio_block_f32_t **iqueue_f32) :
+	  AudioStream(ninput, iqueue), destination_list_f32(NULL),
+	  inputQueue_f32(iqueue_f32), num_inputs_f32(ninput_f32) {
+		for (int i=0; i < num_inputs_f32; i++) {
+			inputQueue_f32[i] = NULL;
+		}
+	}
+	static void initialize_f32_memory(audio_block_f32_t *data, unsigned int num);
+	static uint16_t f32_memory_used;
+	static uint16_t f32_memory_used_max;
+protected:
+	static audio_block_f32_t * allocate_f32(void);
+	static void release(audio_block_f32_t *block);
+	using AudioStream::release;
+	void transmit(audio_block_f32_t *block, unsigned char index = 0);
+	using AudioStream::transmit;
+	audio_block_f32_t * receiveReadOnly_f32(unsigned int index = 0);
+	audio_block_f32_t * receiveWritable_f32(unsigned int index = 0);
+	friend class AudioConnection_F32;
+private:
+	AudioConnection_F32 *destination_list_f32;
+	audio_block_f32_t **inputQueue_f32;
+	unsigned char num_inputs_f32;
+	static audio_block_f32_t *memory_pool_f32;
+	static uint32_t memory_pool_available_mask_f32[AUDIO_MEMORY_F32_MAX/32];
+};
+
+#endif
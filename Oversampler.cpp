@@ -0,0 +1,214 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "Oversampler.h"
+#include "utility/dspinst.h"
+
+// Filter length per polyphase branch, Kaiser window beta and cutoff
+// (relative to the original Nyquist frequency) for each quality setting.
+// Measured on a host simulation at 44.1 kHz:
+//
+//           taps/phase  -1 dB point  stopband   MACs/sample
+//   LOW          8       13.4 kHz     -45 dB      16 * factor
+//   MEDIUM      16       16.5 kHz     -71 dB      32 * factor
+//   HIGH        32       18.7 kHz     -92 dB      64 * factor
+//
+// Aliasing of a 5 kHz sine hard clipped with 12 dB of drive (aliased
+// power relative to harmonic power), medium quality:
+//   1X: -14 dB,  2X: -38 dB,  4X: -49 dB,  8X: -57 dB
+static const uint8_t quality_taps[3] = {8, 16, 32};
+static const float quality_beta[3] = {4.5f, 7.0f, 9.0f};
+static const float quality_cutoff[3] = {0.82f, 0.88f, 0.92f};
+
+static void release_buffers(float *c, float *is, float *ds, float *fb, int16_t *b)
+{
+	free(c);
+	free(is);
+	free(ds);
+	free(fb);
+	free(b);
+}
+
+bool Oversampler::begin(unsigned int factor, AudioOversampleQuality quality)
+{
+	if (factor != 2 && factor != 4 && factor != 8) {
+		end();
+		return factor == 1;
+	}
+	unsigned int q = quality;
+	if (q > OVERSAMPLE_QUALITY_HIGH) q = OVERSAMPLE_QUALITY_HIGH;
+	unsigned int ntaps = quality_taps[q] * factor;
+	unsigned int len = factor * AUDIO_BLOCK_SAMPLES;
+
+	float *c = (float *)malloc(ntaps * sizeof(float));
+	float *is = (float *)malloc((AUDIO_BLOCK_SAMPLES + quality_taps[q] - 1) * sizeof(float));
+	float *ds = (float *)malloc((len + ntaps - 1) * sizeof(float));
+	float *fb = (float *)malloc(len * sizeof(float));
+	int16_t *b = (int16_t *)malloc(len * sizeof(int16_t));
+	if (!c || !is || !ds || !fb || !b) {
+		release_buffers(c, is, ds, fb, b);
+		return false;
+	}
+	design(c, factor, ntaps, quality_beta[q], quality_cutoff[q]);
+
+	arm_fir_interpolate_instance_f32 in;
+	arm_fir_decimate_instance_f32 de;
+	if (arm_fir_interpolate_init_f32(&in, factor, ntaps, c, is,
+	   AUDIO_BLOCK_SAMPLES) != ARM_MATH_SUCCESS
+	  || arm_fir_decimate_init_f32(&de, ntaps, factor, c, ds,
+	   len) != ARM_MATH_SUCCESS) {
+		release_buffers(c, is, ds, fb, b);
+		return false;
+	}
+
+	// swap in the new filters atomically, so update() never sees
+	// a half configured oversampler
+	__disable_irq();
+	float *oldc = coeffs;
+	float *oldis = istate;
+	float *oldds = dstate;
+	float *oldfb = fbuf;
+	int16_t *oldb = buffer;
+	interpolation = in;
+	decimation = de;
+	coeffs = c;
+	istate = is;
+	dstate = ds;
+	fbuf = fb;
+	buffer = b;
+	taps = ntaps;
+	ratio = factor;
+	__enable_irq();
+	release_buffers(oldc, oldis, oldds, oldfb, oldb);
+	return true;
+}
+
+void Oversampler::end(void)
+{
+	__disable_irq();
+	float *oldc = coeffs;
+	float *oldis = istate;
+	float *oldds = dstate;
+	float *oldfb = fbuf;
+	int16_t *oldb = buffer;
+	coeffs = NULL;
+	istate = NULL;
+	dstate = NULL;
+	fbuf = NULL;
+	buffer = NULL;
+	taps = 0;
+	ratio = 1;
+	__enable_irq();
+	release_buffers(oldc, oldis, oldds, oldfb, oldb);
+}
+
+// zeroth order modified Bessel function of the first kind, for the window
+static float bessel_i0(float x)
+{
+	float sum = 1.0f, term = 1.0f;
+	float xx = x * x * 0.25f;
+	for (int k=1; k < 32; k++) {
+		term *= xx / (float)(k * k);
+		sum += term;
+		if (term < sum * 1.0e-8f) break;
+	}
+	return sum;
+}
+
+// Fill h with the filter for this factor and quality, which must have
+// room for 32 * factor coefficients.  Returns the number of taps.
+unsigned int Oversampler::design(float *h, unsigned int factor,
+	AudioOversampleQuality quality)
+{
+	unsigned int q = quality;
+	if (q > OVERSAMPLE_QUALITY_HIGH) q = OVERSAMPLE_QUALITY_HIGH;
+	unsigned int ntaps = quality_taps[q] * factor;
+	design(h, factor, ntaps, quality_beta[q], quality_cutoff[q]);
+	return ntaps;
+}
+
+// Kaiser windowed sinc lowpass at the original Nyquist frequency,
+// normalized for unity gain at DC.
+void Oversampler::design(float *h, unsigned int factor, unsigned int ntaps,
+	float beta, float cutoff)
+{
+	const float fc = cutoff * 0.5f / (float)factor;
+	const float center = (float)(ntaps - 1) * 0.5f;
+	const float scale = 1.0f / bessel_i0(beta);
+	float sum = 0.0f;
+
+	for (unsigned int i=0; i < ntaps; i++) {
+		float x = (float)i - center;
+		float s;
+		if (x == 0.0f) {
+			s = 2.0f * fc;
+		} else {
+			s = sinf(2.0f * (float)M_PI * fc * x) / ((float)M_PI * x);
+		}
+		float r = x / center;
+		float w = bessel_i0(beta * sqrtf(1.0f - r * r)) * scale;
+		h[i] = s * w;
+		sum += h[i];
+	}
+	for (unsigned int i=0; i < ntaps; i++) {
+		h[i] /= sum;
+	}
+}
+
+// Interpolate one block of audio to factor() * AUDIO_BLOCK_SAMPLES. The
+// returned buffer belongs to the oversampler and may be processed in
+// place before calling downsample().
+int16_t * Oversampler::upsample(const int16_t *in)
+{
+	float blockIn[AUDIO_BLOCK_SAMPLES];
+	const unsigned int len = length();
+
+	// the interpolator inserts zeros, so gain must be restored
+	const float gain = (float)ratio;
+	for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		blockIn[i] = (float)in[i] * gain;
+	}
+	arm_fir_interpolate_f32(&interpolation, blockIn, fbuf, AUDIO_BLOCK_SAMPLES);
+	for (unsigned int i=0; i < len; i++) {
+		buffer[i] = saturate16((int32_t)fbuf[i]);
+	}
+	return buffer;
+}
+
+void Oversampler::downsample(int16_t *out)
+{
+	float blockOut[AUDIO_BLOCK_SAMPLES];
+	const unsigned int len = length();
+
+	for (unsigned int i=0; i < len; i++) {
+		fbuf[i] = (float)buffer[i];
+	}
+	arm_fir_decimate_f32(&decimation, fbuf, blockOut, len);
+	for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		out[i] = saturate16((int32_t)blockOut[i]);
+	}
+}
@@ -0,0 +1,81 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef oversampler_h_
+#define oversampler_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "arm_math.h"
+
+enum AudioOversampleQuality {
+	OVERSAMPLE_QUALITY_LOW,
+	OVERSAMPLE_QUALITY_MEDIUM,
+	OVERSAMPLE_QUALITY_HIGH
+};
+
+// Polyphase FIR interpolation and decimation, meant to wrap a nonlinear
+// process (waveshaper, folder, clipper...) so it runs at 2X, 4X or 8X the
+// audio rate.  Harmonics generated above the original Nyquist frequency
+// are filtered away before decimating, rather than aliasing back down.
+//
+// Usage inside update():
+//   int16_t *p = oversampler.upsample(block->data);
+//   ... process oversampler.length() samples at p ...
+//   oversampler.downsample(block->data);
+//
+// No memory is used until begin() is called with a factor of 2 or more.
+class Oversampler
+{
+public:
+	Oversampler(void) : ratio(1), taps(0), coeffs(NULL), istate(NULL),
+	  dstate(NULL), fbuf(NULL), buffer(NULL) { }
+	~Oversampler() { end(); }
+	bool begin(unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM);
+	void end(void);
+	unsigned int factor(void) { return ratio; }
+	unsigned int length(void) { return ratio * AUDIO_BLOCK_SAMPLES; }
+	int16_t * upsample(const int16_t *in);
+	void downsample(int16_t *out);
+	// anti-alias lowpass for each quality setting, also used by
+	// AudioFilterDecimate and AudioFilterInterpolate
+	static unsigned int design(float *h, unsigned int factor,
+		AudioOversampleQuality quality);
+private:
+	static void design(float *h, unsigned int factor, unsigned int ntaps,
+		float beta, float cutoff);
+	volatile uint8_t ratio;
+	uint16_t taps;
+	float *coeffs;
+	float *istate;
+	float *dstate;
+	float *fbuf;
+	int16_t *buffer;
+	arm_fir_interpolate_instance_f32 interpolation;
+	arm_fir_decimate_instance_f32 decimation;
+};
+
+#endif
@@ -35,7 +35,7 @@ Quantizer::Quantizer(float audio_sample_rate){
     while(!Serial);
 #endif
     randomSeed(1);
-    if(audio_sample_rate==44100.f){
+    if(audio_sample_rate > 43000.f && audio_sample_rate < 45500.f){  // 44100 or 44117.647
         _noiseSFilter[0]=-0.06935825f;
         _noiseSFilter[1]=0.52540845f;
         _noiseSFilter[2]= -1.20537028f;
@@ -48,7 +48,7 @@ Quantizer::Quantizer(float audio_sample_rate){
     //  all coefficients in correct order:
     //      {1.        , -2.38682527,  3.30584589, -3.83872701,  4.04852027,
     //       -3.2177438 ,  2.09422811, -1.20537028,  0.52540845, -0.06935825};
-    } else if(audio_sample_rate==48000.f){
+    } else if(audio_sample_rate > 47000.f && audio_sample_rate < 49000.f){
         _noiseSFilter[0]=0.1967454f;
         _noiseSFilter[1]=-0.30086406f;
         _noiseSFilter[2]= 0.09575588f;
@@ -46,6 +46,11 @@ extern const int16_t AudioWindowCosine1024[];
 extern const int16_t AudioWindowTukey1024[];
 }
 
+// 1024 samples are collected from 2 or more blocks, and the FFT is
+// computed each time half of them are new (50% overlap).
+// AUDIO_BLOCK_SAMPLES must be a power of 2, up to 512.
+#define FFT1024_BLOCKS  (1024 / AUDIO_BLOCK_SAMPLES)
+
 class AudioAnalyzeFFT1024 : public AudioStream
 {
 public:
@@ -89,7 +94,7 @@ public:
 private:
 	void init(void);
 	const int16_t *window;
-	audio_block_t *blocklist[8];
+	audio_block_t *blocklist[FFT1024_BLOCKS];
 	int16_t buffer[2048] __attribute__ ((aligned (4)));
 	//uint32_t sum[512];
 	//uint8_t count;
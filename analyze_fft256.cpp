@@ -62,13 +62,20 @@ void AudioAnalyzeFFT256::update(void)
 
 	block = receiveReadOnly();
 	if (!block) return;
-#if AUDIO_BLOCK_SAMPLES == 128 && defined (__ARM_ARCH_7EM__)
-	if (!prevblock) {
-		prevblock = block;
-		return;
+#if defined(__ARM_ARCH_7EM__)
+#if FFT256_BLOCKS > 1
+	blocklist[state++] = block;
+	if (state < FFT256_BLOCKS) return;
+	for (int i=0; i < FFT256_BLOCKS; i++) {
+		copy_to_fft_buffer(buffer + i * AUDIO_BLOCK_SAMPLES * 2, blocklist[i]->data);
 	}
-	copy_to_fft_buffer(buffer, prevblock->data);
-	copy_to_fft_buffer(buffer+256, block->data);
+#else
+	const uint16_t *src = (const uint16_t *)(block->data + AUDIO_BLOCK_SAMPLES - 256);
+	uint32_t *dst = (uint32_t *)buffer;
+	for (int i=0; i < 256; i++) {
+		*dst++ = *src++;  // real sample plus a zero for imaginary
+	}
+#endif
 	//window = AudioWindowBlackmanNuttall256;
 	//window = NULL;
 	if (window) apply_window_to_fft_buffer(buffer, window);
@@ -95,38 +102,17 @@ void AudioAnalyzeFFT256::update(void)
 		}
 		outputflag = true;
 	}
-	release(prevblock);
-	prevblock = block;
-#elif AUDIO_BLOCK_SAMPLES == 64
-	if (prevblocks[2] == NULL) {
-		prevblocks[2] = prevblocks[1];
-		prevblocks[1] = prevblocks[0];
-		prevblocks[0] = block;
-		return;
-	}
-	if (count == 0) {
-		count = 1;
-		copy_to_fft_buffer(buffer, prevblocks[2]->data);
-		copy_to_fft_buffer(buffer+128, prevblocks[1]->data);
-		copy_to_fft_buffer(buffer+256, prevblocks[1]->data);
-		copy_to_fft_buffer(buffer+384, block->data);
-		if (window) apply_window_to_fft_buffer(buffer, window);
-		arm_cfft_radix4_q15(&fft_inst, buffer);
-	} else {
-		count = 2;
-		const uint32_t *p = (uint32_t *)buffer;
-		for (int i=0; i < 128; i++) {
-			uint32_t tmp = *p++;
-			int16_t v1 = tmp & 0xFFFF;
-			int16_t v2 = tmp >> 16;
-			output[i] = sqrt_uint32_approx(v1 * v1 + v2 * v2);
-		}
+#if FFT256_BLOCKS > 1
+	// keep the newest half of the samples, for 50% overlap
+	for (int i=0; i < FFT256_BLOCKS/2; i++) {
+		release(blocklist[i]);
+		blocklist[i] = blocklist[i + FFT256_BLOCKS/2];
 	}
-	release(prevblocks[2]);
-	prevblocks[2] = prevblocks[1];
-	prevblocks[1] = prevblocks[0];
-	prevblocks[0] = block;
+	state = FFT256_BLOCKS/2;
+#else
+	release(block);
+#endif
+#else
+	release(block);
 #endif
 }
-
-
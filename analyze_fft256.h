@@ -46,20 +46,23 @@ extern const int16_t AudioWindowCosine256[];
 extern const int16_t AudioWindowTukey256[];
 }
 
+// 256 samples are collected from 2 or more blocks, and the FFT is
+// computed each time half of them are new (50% overlap).  With blocks
+// of 256 samples or more, the newest 256 samples of each block are used.
+#if AUDIO_BLOCK_SAMPLES < 256
+#define FFT256_BLOCKS  (256 / AUDIO_BLOCK_SAMPLES)
+#else
+#define FFT256_BLOCKS  1
+#endif
+
 class AudioAnalyzeFFT256 : public AudioStream
 {
 public:
 	AudioAnalyzeFFT256() : AudioStream(1, inputQueueArray),
 	  window(AudioWindowHanning256), count(0), outputflag(false) {
 		arm_cfft_radix4_init_q15(&fft_inst, 256, 0, 1);
-#if AUDIO_BLOCK_SAMPLES == 128
-		prevblock = NULL;
+		state = 0;
 		naverage = 8;
-#elif AUDIO_BLOCK_SAMPLES == 64
-		prevblocks[0] = NULL;
-		prevblocks[1] = NULL;
-		prevblocks[2] = NULL;
-#endif
 	}
 	bool available() {
 		if (outputflag == true) {
@@ -87,10 +90,8 @@ public:
 		return (float)sum * (1.0f / 16384.0f);
 	}
 	void averageTogether(uint8_t n) {
-#if AUDIO_BLOCK_SAMPLES == 128
 		if (n == 0) n = 1;
 		naverage = n;
-#endif
 	}
 	void windowFunction(const int16_t *w) {
 		window = w;
@@ -99,16 +100,11 @@ public:
 	uint16_t output[128] __attribute__ ((aligned (4)));
 private:
 	const int16_t *window;
-#if AUDIO_BLOCK_SAMPLES == 128
-	audio_block_t *prevblock;
-#elif AUDIO_BLOCK_SAMPLES == 64
-	audio_block_t *prevblocks[3];
-#endif
+	audio_block_t *blocklist[FFT256_BLOCKS];
 	int16_t buffer[512] __attribute__ ((aligned (4)));
-#if AUDIO_BLOCK_SAMPLES == 128
 	uint32_t sum[128];
 	uint8_t naverage;
-#endif
+	uint8_t state;
 	uint8_t count;
 	volatile bool outputflag;
 	audio_block_t *inputQueueArray[1];
@@ -62,16 +62,16 @@ void AudioAnalyzeNoteFrequency::update( void ) {
         if ( !first_run && process_buffer ) process( );
     }
     
-    if ( state >= AUDIO_GUITARTUNER_BLOCKS ) {
+    if ( state >= AUDIO_GUITARTUNER_INPUT_BLOCKS ) {
         if ( next_buffer ) {
             if ( !first_run && process_buffer ) process( );
-            for ( int i = 0; i < AUDIO_GUITARTUNER_BLOCKS; i++ ) copy_buffer( AudioBuffer+( i * 0x80 ), blocklist1[i]->data );
-            for ( int i = 0; i < AUDIO_GUITARTUNER_BLOCKS; i++ ) release( blocklist1[i] );
+            for ( int i = 0; i < AUDIO_GUITARTUNER_INPUT_BLOCKS; i++ ) copy_buffer( AudioBuffer+( i * AUDIO_BLOCK_SAMPLES ), blocklist1[i]->data );
+            for ( int i = 0; i < AUDIO_GUITARTUNER_INPUT_BLOCKS; i++ ) release( blocklist1[i] );
             next_buffer = false;
         } else {
             if ( !first_run && process_buffer ) process( );
-            for ( int i = 0; i < AUDIO_GUITARTUNER_BLOCKS; i++ ) copy_buffer( AudioBuffer+( i * 0x80 ), blocklist2[i]->data );
-            for ( int i = 0; i < AUDIO_GUITARTUNER_BLOCKS; i++ ) release( blocklist2[i] );
+            for ( int i = 0; i < AUDIO_GUITARTUNER_INPUT_BLOCKS; i++ ) copy_buffer( AudioBuffer+( i * AUDIO_BLOCK_SAMPLES ), blocklist2[i]->data );
+            for ( int i = 0; i < AUDIO_GUITARTUNER_INPUT_BLOCKS; i++ ) release( blocklist2[i] );
             next_buffer = true;
         }
         process_buffer = true;
@@ -94,7 +94,8 @@ void AudioAnalyzeNoteFrequency::process( void ) {
     const int16_t *p;
     p = AudioBuffer;
     
-    uint16_t cycles = 64;
+    // spread the work evenly over all the blocks which fill the buffer
+    uint16_t cycles = AUDIO_BLOCK_SAMPLES / 2;
     uint16_t tau = tau_global;
     do {
         uint16_t x   = 0;
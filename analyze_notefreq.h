@@ -39,6 +39,9 @@
  ***********************************************************************/
 #define AUDIO_GUITARTUNER_BLOCKS  24
 /***********************************************************************/
+// the buffer is always 128 * AUDIO_GUITARTUNER_BLOCKS samples, collected
+// from however many audio blocks that takes
+#define AUDIO_GUITARTUNER_INPUT_BLOCKS  (AUDIO_GUITARTUNER_BLOCKS * 128 / AUDIO_BLOCK_SAMPLES)
 class AudioAnalyzeNoteFrequency : public AudioStream {
 public:
     /**
@@ -127,8 +130,8 @@ private:
     float    periodicity, yin_threshold, cpu_usage_max, data;
     bool     enabled, next_buffer, first_run;
     volatile bool new_output, process_buffer;
-    audio_block_t *blocklist1[AUDIO_GUITARTUNER_BLOCKS];
-    audio_block_t *blocklist2[AUDIO_GUITARTUNER_BLOCKS];
+    audio_block_t *blocklist1[AUDIO_GUITARTUNER_INPUT_BLOCKS];
+    audio_block_t *blocklist2[AUDIO_GUITARTUNER_INPUT_BLOCKS];
     audio_block_t *inputQueueArray[1];
 };
 #endif
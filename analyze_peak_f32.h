@@ -0,0 +1,81 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef analyze_peak_f32_h_
+#define analyze_peak_f32_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "AudioStream_F32.h"
+
+class AudioAnalyzePeak_F32 : public AudioStream_F32
+{
+public:
+	AudioAnalyzePeak_F32(void) : AudioStream_F32(0, NULL, 1, inputQueueArray_f32) {
+		min_sample = 1e30f;
+		max_sample = -1e30f;
+		new_output = false;
+	}
+	bool available(void) {
+		__disable_irq();
+		bool flag = new_output;
+		if (flag) new_output = false;
+		__enable_irq();
+		return flag;
+	}
+	float read(void) {
+		__disable_irq();
+		float min = min_sample;
+		float max = max_sample;
+		min_sample = 1e30f;
+		max_sample = -1e30f;
+		__enable_irq();
+		if (max < min) return 0.0f;
+		min = fabsf(min);
+		max = fabsf(max);
+		if (min > max) max = min;
+		return max;
+	}
+	float readPeakToPeak(void) {
+		__disable_irq();
+		float min = min_sample;
+		float max = max_sample;
+		min_sample = 1e30f;
+		max_sample = -1e30f;
+		__enable_irq();
+		if (max < min) return 0.0f;
+		return max - min;
+	}
+
+	virtual void update(void);
+private:
+	audio_block_f32_t *inputQueueArray_f32[1];
+	volatile bool new_output;
+	float min_sample;
+	float max_sample;
+};
+
+#endif
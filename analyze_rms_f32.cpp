@@ -0,0 +1,62 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "analyze_rms_f32.h"
+
+void AudioAnalyzeRMS_F32::update(void)
+{
+	audio_block_f32_t *block = receiveReadOnly_f32();
+	if (!block) {
+		count++;
+		return;
+	}
+	const float *p = block->data;
+	const float *end = p + AUDIO_BLOCK_SAMPLES;
+	// sum each block in single precision, which the FPU does quickly,
+	// and only accumulate the blocks in double precision
+	float sum = 0.0f;
+	do {
+		float n = *p++;
+		sum += n * n;
+	} while (p < end);
+	accum += sum;
+	count++;
+	release(block);
+}
+
+float AudioAnalyzeRMS_F32::read(void)
+{
+	__disable_irq();
+	double sum = accum;
+	accum = 0;
+	uint32_t num = count;
+	count = 0;
+	__enable_irq();
+	if (num == 0) return 0.0f;
+	float meansq = sum / (num * AUDIO_BLOCK_SAMPLES);
+	return sqrtf(meansq);
+}
@@ -0,0 +1,90 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "convert_f32.h"
+#include "utility/dspinst.h"
+
+void AudioConvertI16toF32::update(void)
+{
+	audio_block_t *in;
+	audio_block_f32_t *out;
+	int i;
+
+	in = receiveReadOnly();
+	if (!in) return;
+	out = allocate_f32();
+	if (out) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			out->data[i] = (float)in->data[i] * (1.0f / 32768.0f);
+		}
+		transmit(out);
+		release(out);
+	}
+	release(in);
+}
+
+void AudioConvertF32toI16::dither(bool enable, bool noiseShaping)
+{
+	Quantizer *q = NULL, *old;
+
+	if (enable || noiseShaping) {
+		q = new Quantizer(AUDIO_SAMPLE_RATE_EXACT);
+		q->configure(noiseShaping, enable, 32767.0f);
+	}
+	__disable_irq();
+	old = quantizer;
+	quantizer = q;
+	__enable_irq();
+	delete old;
+}
+
+void AudioConvertF32toI16::update(void)
+{
+	audio_block_f32_t *in;
+	audio_block_t *out;
+	int i;
+
+	in = receiveReadOnly_f32();
+	if (!in) return;
+	out = allocate();
+	if (out) {
+		if (quantizer) {
+			quantizer->quantize(in->data, out->data, AUDIO_BLOCK_SAMPLES);
+		} else {
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				float n = in->data[i] * 32768.0f;
+				n += (n >= 0.0f) ? 0.5f : -0.5f;  // round to nearest
+				if (n > 32767.0f) n = 32767.0f;
+				else if (n < -32768.0f) n = -32768.0f;
+				out->data[i] = (int16_t)n;
+			}
+		}
+		transmit(out);
+		release(out);
+	}
+	release(in);
+}
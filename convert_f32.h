@@ -0,0 +1,59 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef convert_f32_h_
+#define convert_f32_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "AudioStream_F32.h"
+#include "Quantizer.h"
+
+// 16 bit integer audio to floating point, -32768 becomes -1.0
+class AudioConvertI16toF32 : public AudioStream_F32
+{
+public:
+	AudioConvertI16toF32(void) : AudioStream_F32(1, inputQueueArray, 0, NULL) { }
+	virtual void update(void);
+private:
+	audio_block_t *inputQueueArray[1];
+};
+
+// floating point audio to 16 bit integer, with optional dither
+// and noise shaping when reducing high resolution signals
+class AudioConvertF32toI16 : public AudioStream_F32
+{
+public:
+	AudioConvertF32toI16(void) : AudioStream_F32(0, NULL, 1, inputQueueArray_f32),
+	  quantizer(NULL) { }
+	virtual void update(void);
+	void dither(bool enable, bool noiseShaping = false);
+private:
+	audio_block_f32_t *inputQueueArray_f32[1];
+	Quantizer *quantizer;
+};
+
+#endif
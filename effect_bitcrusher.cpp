@@ -33,9 +33,7 @@
 void AudioEffectBitcrusher::update(void)
 {
 	audio_block_t *block;
-	uint32_t i;
-	uint32_t sampleSquidge, sampleSqueeze; //squidge is bitdepth, squeeze is for samplerate
-			
+
 	if (crushBits == 16 && sampleStep <= 1) {
 		// nothing to do. Output is sent through clean, then exit the function
 		block = receiveReadOnly();
@@ -44,40 +42,58 @@ void AudioEffectBitcrusher::update(void)
 		release(block);
 		return;
 	}
-	// start of processing functions. Could be more elegant based on external
-	// functions but left like this to enable code optimisation later.
 	block = receiveWritable();
 	if (!block) return;
 
-	if (sampleStep <= 1) { //no sample rate mods, just crush the bitdepth.
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+	if (oversampler.factor() > 1) {
+		// crush at the higher rate, holding each root sample for the
+		// same length of time, then filter the steps back down
+		int16_t *os = oversampler.upsample(block->data);
+		crush(os, oversampler.length(), sampleStep * oversampler.factor());
+		oversampler.downsample(block->data);
+	} else {
+		crush(block->data, AUDIO_BLOCK_SAMPLES, sampleStep);
+	}
+	transmit(block);
+	release(block);
+}
+
+// start of processing functions. Could be more elegant based on external
+// functions but left like this to enable code optimisation later.
+void AudioEffectBitcrusher::crush(int16_t *data, uint32_t len, uint32_t step)
+{
+	uint32_t i;
+	uint32_t sampleSquidge, sampleSqueeze; //squidge is bitdepth, squeeze is for samplerate
+
+	if (step <= 1) { //no sample rate mods, just crush the bitdepth.
+		for (i=0; i < len; i++) {
 			// shift bits right to cut off fine detail sampleSquidge is a
 			// uint32 so sign extension will not occur, fills with zeroes.
-			sampleSquidge = block->data[i] >> (16-crushBits);
+			sampleSquidge = data[i] >> (16-crushBits);
 			// shift bits left again to regain the volume level.
 			// fills with zeroes.
-		 	block->data[i] = sampleSquidge << (16-crushBits);
+		 	data[i] = sampleSquidge << (16-crushBits);
 		}
 	} else if (crushBits == 16) { //bitcrusher not being used, samplerate mods only.
 		i=0;
-		while (i < AUDIO_BLOCK_SAMPLES) {
+		while (i < len) {
 			// save the root sample. this will pick up a root
 			// sample every _sampleStep_ samples.
-			sampleSqueeze = block->data[i];
-			for (int j = 0; j < sampleStep && i < AUDIO_BLOCK_SAMPLES; j++) {
+			sampleSqueeze = data[i];
+			for (uint32_t j = 0; j < step && i < len; j++) {
  				// for each repeated sample, paste in the current
 				// root sample, then move onto the next step.
-				block->data[i] = sampleSqueeze;
+				data[i] = sampleSqueeze;
 				i++;
 			}
 		}
 	} else {           //both being used. crush those bits and mash those samples.
 		i=0;
-		while (i < AUDIO_BLOCK_SAMPLES) {
+		while (i < len) {
 			// save the root sample. this will pick up a root sample
 			// every _sampleStep_ samples.
-			sampleSqueeze = block->data[i];
-			for (int j = 0; j < sampleStep && i < AUDIO_BLOCK_SAMPLES; j++) {
+			sampleSqueeze = data[i];
+			for (uint32_t j = 0; j < step && i < len; j++) {
  				// shift bits right to cut off fine detail sampleSquidge
 				// is a uint32 so sign extension will not occur, fills
 				// with zeroes.
@@ -85,13 +101,9 @@ void AudioEffectBitcrusher::update(void)
  				// shift bits left again to regain the volume level.
 				// fills with zeroes. paste into buffer sample +
 				// sampleStep offset.
-				block->data[i] = sampleSquidge << (16-crushBits);
+				data[i] = sampleSquidge << (16-crushBits);
 				i++;
 			}
 		}
 	}
-	transmit(block);
-	release(block);
 }
-
-
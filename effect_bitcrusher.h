@@ -30,6 +30,7 @@
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "Oversampler.h"
 
 class AudioEffectBitcrusher : public AudioStream
 {
@@ -47,9 +48,14 @@ public:
 		else if (n > 64) n = 64;
 		sampleStep = n;
 	}
+	bool oversample(unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM) {
+		return oversampler.begin(factor, quality);
+	}
 	virtual void update(void);
 	
 private:
+	void crush(int16_t *data, uint32_t len, uint32_t step);
+	Oversampler oversampler;
 	uint8_t crushBits; // 16 = off
 	uint8_t sampleStep; // the number of samples to double up. This simple technique only allows a few stepped positions.
 	audio_block_t *inputQueueArray[1];
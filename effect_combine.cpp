@@ -27,15 +27,16 @@
  
 #include <Arduino.h>
 #include "effect_combine.h"
+#include "utility/inplace.h"
 
 void AudioEffectDigitalCombine::update(void)
 {
-	audio_block_t *blocka, *blockb;
-	uint32_t *pa, *pb, *end;
+	audio_block_t *blocka, *blockb, *out;
+	uint32_t *pa, *pb, *po, *end;
 	uint32_t a12, a34; //, a56, a78;
 	uint32_t b12, b34; //, b56, b78;
 
-	blocka = receiveWritable(0);
+	blocka = receiveReadOnly(0);
 	blockb = receiveReadOnly(1);
 	if (!blocka) {
 		if (blockb) release(blockb);
@@ -45,13 +46,20 @@ void AudioEffectDigitalCombine::update(void)
 		release(blocka);
 		return;
 	}
+	out = writable_output(blocka, allocate);
+	if (!out) {
+		release(blocka);
+		release(blockb);
+		return;
+	}
 	pa = (uint32_t *)(blocka->data);
 	pb = (uint32_t *)(blockb->data);
+	po = (uint32_t *)(out->data);
 	end = pa + AUDIO_BLOCK_SAMPLES / 2;
 
 	while (pa < end) {
-		a12 = *pa;
-		a34 = *(pa + 1);
+		a12 = *pa++;
+		a34 = *pa++;
 		b12 = *pb++;
 		b34 = *pb++;
 		if (mode_sel == OR) {
@@ -70,11 +78,12 @@ void AudioEffectDigitalCombine::update(void)
 			a12 = a12 % b12;
 			a34 = a34 % b34;
 		}
-		*pa++ = a12;
-		*pa++ = a34;
+		*po++ = a12;
+		*po++ = a34;
 	}
-	transmit(blocka);
-	release(blocka);
+	transmit(out);
+	release(out);
+	if (out != blocka) release(blocka);
 	release(blockb);
 }
 
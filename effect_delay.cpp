@@ -27,6 +27,30 @@
 #include <Arduino.h>
 #include "effect_delay.h"
 
+// Keep an incoming block in the secondary pool if there is room, so the
+// delay line doesn't hold blocks from AudioMemory().
+audio_block_t * AudioEffectDelay::store(audio_block_t *block)
+{
+	audio_block_t *copy;
+
+	if (!block) return NULL;
+	copy = AudioSecondaryPool::allocate();
+	if (!copy) return account_add(block);
+	memcpy(copy->data, block->data, sizeof(copy->data));
+	release(block);
+	return copy;
+}
+
+void AudioEffectDelay::discard(audio_block_t *block)
+{
+	if (AudioSecondaryPool::contains(block)) {
+		AudioSecondaryPool::release(block);
+	} else {
+		release(block);
+		account_remove();
+	}
+}
+
 void AudioEffectDelay::update(void)
 {
 	audio_block_t *output;
@@ -39,10 +63,10 @@ void AudioEffectDelay::update(void)
 	tail = tailindex;
 	if (++head >= DELAY_QUEUE_SIZE) head = 0;
 	if (head == tail) {
-		if (queue[tail] != NULL) release(queue[tail]);
+		if (queue[tail] != NULL) discard(queue[tail]);
 		if (++tail >= DELAY_QUEUE_SIZE) tail = 0;
 	}
-	queue[head] = receiveReadOnly();
+	queue[head] = store(receiveReadOnly());
 	headindex = head;
 
 	// testing only.... don't allow null pointers into the queue
@@ -72,7 +96,7 @@ void AudioEffectDelay::update(void)
 		count -= maxblocks;
 		do {
 			if (queue[tail] != NULL) {
-				release(queue[tail]);
+				discard(queue[tail]);
 				queue[tail] = NULL;
 			}
 			if (++tail >= DELAY_QUEUE_SIZE) tail = 0;
@@ -92,12 +116,20 @@ void AudioEffectDelay::update(void)
 		}
 		if (offset == 0) {
 			// delay falls on the block boundary
-			if (queue[index]) {
+			if (queue[index] && AudioSecondaryPool::contains(queue[index])) {
+				// secondary blocks can't be transmitted, send a copy
+				output = account_allocate(allocate());
+				if (!output) continue;
+				memcpy(output->data, queue[index]->data, sizeof(output->data));
+				transmit(output, channel);
+				release(output);
+				account_remove();
+			} else if (queue[index]) {
 				transmit(queue[index], channel);
 			}
 		} else {
 			// delay requires grabbing data from 2 blocks
-			output = allocate();
+			output = account_allocate(allocate());
 			if (!output) continue;
 			dst = output->data;
 			if (index > 0) {
@@ -130,6 +162,7 @@ void AudioEffectDelay::update(void)
 			}
 			transmit(output, channel);
 			release(output);
+			account_remove();
 		}
 	}
 
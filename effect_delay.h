@@ -29,6 +29,8 @@
 #include "Arduino.h"
 #include "AudioStream.h"
 #include "utility/dspinst.h"
+#include "utility/memory_account.h"
+#include "utility/secondary_pool.h"
 
 #if defined(__IMXRT1062__)
   // 4.00 second maximum on Teensy 4.0
@@ -47,7 +49,9 @@
   #define DELAY_QUEUE_SIZE  (6144 / AUDIO_BLOCK_SAMPLES)
 #endif
 
-class AudioEffectDelay : public AudioStream
+// Blocks of delayed input are held in the secondary pool when
+// AudioMemorySecondary() was used, otherwise they come from AudioMemory().
+class AudioEffectDelay : public AudioStream, public AudioMemoryAccount
 {
 public:
 	AudioEffectDelay() : AudioStream(1, inputQueueArray) {
@@ -90,6 +94,8 @@ public:
 	}
 	virtual void update(void);
 private:
+	audio_block_t * store(audio_block_t *block);
+	void discard(audio_block_t *block);
 	void recompute_maxblocks(void) {
 		uint32_t max=0;
 		uint32_t channel = 0;
@@ -0,0 +1,184 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "effect_dynamics.h"
+#include "utility/dspinst.h"
+
+// Returns the larger of level and this block's detected power,
+// as squared sample units.  Peak detection uses the largest sample.
+float AudioEffectDynamics::detect(audio_block_t *block, float level)
+{
+	const int16_t *p = block->data;
+	const int16_t *end = p + AUDIO_BLOCK_SAMPLES;
+	float power;
+
+	if (rms) {
+		int64_t sum = 0;
+		do {
+			int32_t s = *p++;
+			sum += s * s;
+		} while (p < end);
+		power = (float)sum * (1.0f / AUDIO_BLOCK_SAMPLES);
+	} else {
+		int32_t peak = 0;
+		do {
+			int32_t s = *p++;
+			if (s < 0) s = -s;
+			if (s > peak) peak = s;
+		} while (p < end);
+		power = (float)(peak * peak);
+	}
+	return (power > level) ? power : level;
+}
+
+// Multiply the block by a gain ramping from g0 to g1, after delaying
+// it by the look-ahead time.
+void AudioEffectDynamics::apply(audio_block_t *block, int channel,
+	float g0, float g1, int n)
+{
+	int16_t *p = block->data;
+	const float inc = (g1 - g0) * (1.0f / AUDIO_BLOCK_SAMPLES);
+	float g = g0;
+	int i;
+
+	if (n > 0) {
+		int16_t *h = history[channel];
+		int16_t input[AUDIO_BLOCK_SAMPLES];
+		memcpy(input, p, sizeof(input));
+		for (i=0; i < n; i++) {
+			g += inc;
+			p[i] = saturate16((int32_t)(h[AUDIO_BLOCK_SAMPLES - n + i] * g));
+		}
+		for (; i < AUDIO_BLOCK_SAMPLES; i++) {
+			g += inc;
+			p[i] = saturate16((int32_t)(input[i - n] * g));
+		}
+		memcpy(h, input, sizeof(input));
+	} else {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			g += inc;
+			p[i] = saturate16((int32_t)(p[i] * g));
+		}
+	}
+}
+
+void AudioEffectDynamics::update(void)
+{
+	audio_block_t *block[2], *side;
+	float level = 0.0f;
+	int i, n = lookahead_samples;
+
+	block[0] = receiveWritable(0);
+	block[1] = receiveWritable(1);
+	side = receiveReadOnly(2);
+	if (side) {
+		level = detect(side, level);
+		release(side);
+	} else {
+		if (block[0]) level = detect(block[0], level);
+		if (block[1]) level = detect(block[1], level);
+	}
+
+	// gain computation, once per block
+	float level_db = -144.0f;
+	if (level > 0.0f) {
+		level_db = 10.0f * log10f(level * (1.0f / (32768.0f * 32768.0f)));
+	}
+	float target = computeGain(level_db);
+	if (n > 0) {
+		// the delayed audio belongs to the previous block, so it
+		// must also get the gain wanted for that block
+		float t = target;
+		if (expander ? (prev_target > target) : (prev_target < target)) {
+			target = prev_target;
+		}
+		prev_target = t;
+	}
+	if (expander ? (target >= gain_db) : (target <= gain_db)) {
+		gain_db = target + attack_coef * (gain_db - target);
+		hold_count = hold_blocks;
+	} else if (hold_count > 0) {
+		hold_count--;
+	} else {
+		gain_db = target + release_coef * (gain_db - target);
+	}
+	float g0 = prev_gain;
+	float g1 = powf(10.0f, (gain_db + makeup_db) * 0.05f);
+	prev_gain = g1;
+
+	// per sample gain, interpolated from the prior block's gain
+	for (i=0; i < 2; i++) {
+		if (!block[i]) {
+			// no input, but look-ahead audio may still be waiting
+			if (n == 0 || !history_active[i]) continue;
+			block[i] = allocate();
+			if (!block[i]) continue;
+			memset(block[i]->data, 0, sizeof(block[i]->data));
+			history_active[i] = false;
+		} else {
+			history_active[i] = true;
+		}
+		apply(block[i], i, g0, g1, n);
+		transmit(block[i], i);
+		release(block[i]);
+	}
+}
+
+float AudioEffectCompressor::computeGain(float level_db)
+{
+	float over = level_db - thresh_db;
+	if (2.0f * over <= -knee_db) return 0.0f;
+	if (2.0f * over >= knee_db) return slope * over;
+	// soft knee, quadratic interpolation across knee_db
+	float k = over + knee_db * 0.5f;
+	return slope * k * k / (2.0f * knee_db);
+}
+
+float AudioEffectLimiter::computeGain(float level_db)
+{
+	float over = level_db - thresh_db;
+	if (2.0f * over <= -knee_db) return 0.0f;
+	if (2.0f * over >= knee_db) return -over;
+	float k = over + knee_db * 0.5f;
+	return -k * k / (2.0f * knee_db);
+}
+
+float AudioEffectGate::computeGain(float level_db)
+{
+	float under = level_db - thresh_db;
+	float g;
+	if (2.0f * under >= knee_db) {
+		g = 0.0f;
+	} else if (2.0f * under <= -knee_db) {
+		g = slope * under;
+	} else {
+		float k = under - knee_db * 0.5f;
+		g = -slope * k * k / (2.0f * knee_db);
+	}
+	if (g < floor_db) g = floor_db;
+	return g;
+}
@@ -0,0 +1,194 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef effect_dynamics_h_
+#define effect_dynamics_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+
+enum AudioEffectDynamicsDetector {
+	DYNAMICS_DETECT_PEAK,
+	DYNAMICS_DETECT_RMS
+};
+
+// Common engine for the compressor, limiter and gate.  Up to 2 channels
+// of audio are processed with linked detection (the loudest channel sets
+// the gain for both), or the level is taken from the side-chain input
+// when it is connected.  The gain is computed once per block and
+// linearly interpolated across the samples.  Optional look-ahead delays
+// the audio by up to 1 block, so the gain can change before a transient
+// arrives.
+class AudioEffectDynamics : public AudioStream
+{
+public:
+	AudioEffectDynamics(bool expand) : AudioStream(3, inputQueueArray),
+	  hold_blocks(0), expander(expand), gain_db(0.0f), prev_target(0.0f),
+	  prev_gain(1.0f), hold_count(0), lookahead_samples(0) {
+		for (int i=0; i < 2; i++) {
+			memset(history[i], 0, sizeof(history[i]));
+			history_active[i] = false;
+		}
+		threshold(-20.0f);
+		kneeWidth(6.0f);
+		attack(5.0f);
+		release(100.0f);
+		makeupGain(0.0f);
+		detector(DYNAMICS_DETECT_PEAK);
+	}
+	void threshold(float dB) {
+		thresh_db = dB;
+	}
+	void kneeWidth(float dB) {
+		if (dB < 0.0f) dB = 0.0f;
+		knee_db = dB;
+	}
+	void attack(float milliseconds) {
+		attack_coef = ms2coef(milliseconds);
+	}
+	void release(float milliseconds) {
+		release_coef = ms2coef(milliseconds);
+	}
+	void makeupGain(float dB) {
+		if (dB > 40.0f) dB = 40.0f;
+		else if (dB < -40.0f) dB = -40.0f;
+		makeup_db = dB;
+	}
+	void detector(AudioEffectDynamicsDetector mode) {
+		rms = (mode == DYNAMICS_DETECT_RMS);
+	}
+	void lookahead(float milliseconds) {
+		int n = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f) + 0.5f;
+		if (n < 0) n = 0;
+		else if (n > AUDIO_BLOCK_SAMPLES) n = AUDIO_BLOCK_SAMPLES;
+		lookahead_samples = n;
+	}
+	// current gain change in dB, not including makeup gain.
+	// Negative numbers are gain reduction.
+	float gainReduction(void) {
+		return gain_db;
+	}
+	using AudioStream::release;
+	virtual void update(void);
+protected:
+	// static curve: gain change in dB for a detected level in dB
+	virtual float computeGain(float level_db) = 0;
+	static float ms2coef(float milliseconds) {
+		if (milliseconds <= 0.0f) return 0.0f;
+		return expf(-(float)AUDIO_BLOCK_SAMPLES /
+			(milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f)));
+	}
+	float thresh_db;
+	float knee_db;
+	uint16_t hold_blocks;
+private:
+	float detect(audio_block_t *block, float level);
+	void apply(audio_block_t *block, int channel, float g0, float g1, int n);
+	audio_block_t *inputQueueArray[3];
+	bool expander;
+	bool rms;
+	float attack_coef;
+	float release_coef;
+	float makeup_db;
+	float gain_db;
+	float prev_target;
+	float prev_gain;
+	uint16_t hold_count;
+	volatile uint16_t lookahead_samples;
+	bool history_active[2];
+	int16_t history[2][AUDIO_BLOCK_SAMPLES];
+};
+
+// Downward compressor: above the threshold, the output level rises
+// by only 1/ratio dB for each dB of input.
+class AudioEffectCompressor : public AudioEffectDynamics
+{
+public:
+	AudioEffectCompressor(void) : AudioEffectDynamics(false) {
+		ratio(4.0f);
+	}
+	void ratio(float r) {
+		if (r < 1.0f) r = 1.0f;
+		slope = 1.0f / r - 1.0f;
+	}
+protected:
+	virtual float computeGain(float level_db);
+private:
+	float slope;
+};
+
+// Peak limiter: an infinite ratio compressor with instant attack and
+// a full block of look-ahead, so the output never exceeds the threshold.
+class AudioEffectLimiter : public AudioEffectDynamics
+{
+public:
+	AudioEffectLimiter(void) : AudioEffectDynamics(false) {
+		threshold(-1.0f);
+		kneeWidth(0.0f);
+		attack(0.0f);
+		release(50.0f);
+		lookahead(AUDIO_BLOCK_SAMPLES * 1000.0f / AUDIO_SAMPLE_RATE_EXACT);
+	}
+protected:
+	virtual float computeGain(float level_db);
+};
+
+// Downward expander / noise gate: below the threshold, the output falls
+// by ratio dB for each dB of input, with no more than range dB of
+// attenuation.  A high ratio gives a gate.
+class AudioEffectGate : public AudioEffectDynamics
+{
+public:
+	AudioEffectGate(void) : AudioEffectDynamics(true) {
+		threshold(-50.0f);
+		kneeWidth(0.0f);
+		attack(1.0f);
+		release(150.0f);
+		ratio(20.0f);
+		range(80.0f);
+		hold(50.0f);
+	}
+	void ratio(float r) {
+		if (r < 1.0f) r = 1.0f;
+		slope = r - 1.0f;
+	}
+	void range(float dB) {
+		if (dB < 0.0f) dB = 0.0f;
+		floor_db = -dB;
+	}
+	void hold(float milliseconds) {
+		if (milliseconds < 0.0f) milliseconds = 0.0f;
+		hold_blocks = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f)
+			/ AUDIO_BLOCK_SAMPLES + 0.5f;
+	}
+protected:
+	virtual float computeGain(float level_db);
+private:
+	float slope;
+	float floor_db;
+};
+
+#endif
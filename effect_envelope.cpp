@@ -26,6 +26,7 @@
 
 #include <Arduino.h>
 #include "effect_envelope.h"
+#include "utility/inplace.h"
 
 #define STATE_IDLE	0
 #define STATE_DELAY	1
@@ -39,6 +40,19 @@
 void AudioEffectEnvelope::noteOn(void)
 {
 	__disable_irq();
+	note_on();
+	__enable_irq();
+}
+
+void AudioEffectEnvelope::noteOff(void)
+{
+	__disable_irq();
+	note_off();
+	__enable_irq();
+}
+
+void AudioEffectEnvelope::note_on(void)
+{
 	if (state == STATE_IDLE || state == STATE_DELAY || release_forced_count == 0) {
 		mult_hires = 0;
 		count = delay_count;
@@ -55,98 +69,178 @@ void AudioEffectEnvelope::noteOn(void)
 		count = release_forced_count;
 		inc_hires = (-mult_hires) / (int32_t)count;
 	}
-	__enable_irq();
 }
 
-void AudioEffectEnvelope::noteOff(void)
+void AudioEffectEnvelope::note_off(void)
 {
-	__disable_irq();
 	if (state != STATE_IDLE && state != STATE_FORCED) {
 		state = STATE_RELEASE;
 		count = release_count;
 		inc_hires = (-mult_hires) / (int32_t)count;
 	}
-	__enable_irq();
+}
+
+void AudioEffectEnvelope::apply_event(void)
+{
+	audio_event_t event;
+
+	events.read(&event);
+	if (event.type == EVENT_NOTE_ON) {
+		note_on();
+	} else {
+		note_off();
+	}
+}
+
+// called when count reaches zero, returns false when the release is done
+bool AudioEffectEnvelope::next_stage(void)
+{
+	if (state == STATE_ATTACK) {
+		count = hold_count;
+		if (count > 0) {
+			state = STATE_HOLD;
+			mult_hires = 0x40000000;
+			inc_hires = 0;
+		} else {
+			state = STATE_DECAY;
+			count = decay_count;
+			inc_hires = (sustain_mult - 0x40000000) / (int32_t)count;
+		}
+	} else if (state == STATE_HOLD) {
+		state = STATE_DECAY;
+		count = decay_count;
+		inc_hires = (sustain_mult - 0x40000000) / (int32_t)count;
+	} else if (state == STATE_DECAY) {
+		state = STATE_SUSTAIN;
+		count = 0xFFFF;
+		mult_hires = sustain_mult;
+		inc_hires = 0;
+	} else if (state == STATE_SUSTAIN) {
+		count = 0xFFFF;
+	} else if (state == STATE_RELEASE) {
+		state = STATE_IDLE;
+		return false;
+	} else if (state == STATE_FORCED) {
+		mult_hires = 0;
+		count = delay_count;
+		if (count > 0) {
+			state = STATE_DELAY;
+			inc_hires = 0;
+		} else {
+			state = STATE_ATTACK;
+			count = attack_count;
+			inc_hires = 0x40000000 / (int32_t)count;
+		}
+	} else if (state == STATE_DELAY) {
+		state = STATE_ATTACK;
+		count = attack_count;
+		inc_hires = 0x40000000 / count;
+	}
+	return true;
+}
+
+// Process part of a block, when events split it.  Each part begins a new
+// 8 sample group, and a final partial group counts as a whole one, so the
+// stage lengths keep their 8 sample resolution while each note starts on
+// its exact sample.
+void AudioEffectEnvelope::process(const int16_t *in, int16_t *out, unsigned int len)
+{
+	while (len > 0) {
+		if (state == STATE_IDLE || (count == 0 && !next_stage())) {
+			while (len > 0) {
+				*out++ = 0;
+				len--;
+			}
+			return;
+		}
+		unsigned int n = (len < 8) ? len : 8;
+		int32_t mult = mult_hires >> 14;
+		int32_t inc = inc_hires >> 17;
+		for (unsigned int i=0; i < n; i++) {
+			mult += inc;
+			*out++ = signed_multiply_32x16b(mult, *in++);
+		}
+		if (n == 8) {
+			mult_hires += inc_hires;
+		} else {
+			mult_hires += (inc_hires >> 3) * (int32_t)n;
+		}
+		count--;
+		len -= n;
+	}
 }
 
 void AudioEffectEnvelope::update(void)
 {
-	audio_block_t *block;
+	audio_block_t *block, *out;
+	const uint32_t *in;
 	uint32_t *p, *end;
 	uint32_t sample12, sample34, sample56, sample78, tmp1, tmp2;
+	unsigned int offset, start;
 
-	block = receiveWritable();
+	events.begin();
+	offset = events.next();
+	block = receiveReadOnly();
+	if (offset < AUDIO_BLOCK_SAMPLES) {
+		// a note begins or ends within this block
+		out = block ? writable_output(block, allocate) : NULL;
+		if (!out) {
+			// the envelope can not advance, but events are still due
+			while (offset < AUDIO_BLOCK_SAMPLES) {
+				apply_event();
+				offset = events.next();
+			}
+			if (block) release(block);
+			return;
+		}
+		start = 0;
+		while (1) {
+			process(block->data + start, out->data + start, offset - start);
+			if (offset >= AUDIO_BLOCK_SAMPLES) break;
+			apply_event();
+			start = offset;
+			offset = events.next();
+			if (offset < start) offset = start;
+		}
+		transmit(out);
+		release(out);
+		if (out != block) release(block);
+		return;
+	}
 	if (!block) return;
 	if (state == STATE_IDLE) {
 		release(block);
 		return;
 	}
-	p = (uint32_t *)(block->data);
+	out = writable_output(block, allocate);
+	if (!out) {
+		release(block);
+		return;
+	}
+	in = (const uint32_t *)(block->data);
+	p = (uint32_t *)(out->data);
 	end = p + AUDIO_BLOCK_SAMPLES/2;
 
 	while (p < end) {
 		// we only care about the state when completing a region
-		if (count == 0) {
-			if (state == STATE_ATTACK) {
-				count = hold_count;
-				if (count > 0) {
-					state = STATE_HOLD;
-					mult_hires = 0x40000000;
-					inc_hires = 0;
-				} else {
-					state = STATE_DECAY;
-					count = decay_count;
-					inc_hires = (sustain_mult - 0x40000000) / (int32_t)count;
-				}
-				continue;
-			} else if (state == STATE_HOLD) {
-				state = STATE_DECAY;
-				count = decay_count;
-				inc_hires = (sustain_mult - 0x40000000) / (int32_t)count;
-				continue;
-			} else if (state == STATE_DECAY) {
-				state = STATE_SUSTAIN;
-				count = 0xFFFF;
-				mult_hires = sustain_mult;
-				inc_hires = 0;
-			} else if (state == STATE_SUSTAIN) {
-				count = 0xFFFF;
-			} else if (state == STATE_RELEASE) {
-				state = STATE_IDLE;
-				while (p < end) {
-					*p++ = 0;
-					*p++ = 0;
-					*p++ = 0;
-					*p++ = 0;
-				}
-				break;
-			} else if (state == STATE_FORCED) {
-				mult_hires = 0;
-				count = delay_count;
-				if (count > 0) {
-					state = STATE_DELAY;
-					inc_hires = 0;
-				} else {
-					state = STATE_ATTACK;
-					count = attack_count;
-					inc_hires = 0x40000000 / (int32_t)count;
-				}
-			} else if (state == STATE_DELAY) {
-				state = STATE_ATTACK;
-				count = attack_count;
-				inc_hires = 0x40000000 / count;
-				continue;
+		if (count == 0 && !next_stage()) {
+			// release has finished
+			while (p < end) {
+				*p++ = 0;
+				*p++ = 0;
+				*p++ = 0;
+				*p++ = 0;
 			}
+			break;
 		}
 
 		int32_t mult = mult_hires >> 14;
 		int32_t inc = inc_hires >> 17;
 		// process 8 samples, using only mult and inc (16 bit resolution)
-		sample12 = *p++;
-		sample34 = *p++;
-		sample56 = *p++;
-		sample78 = *p++;
-		p -= 4;
+		sample12 = *in++;
+		sample34 = *in++;
+		sample56 = *in++;
+		sample78 = *in++;
 		mult += inc;
 		tmp1 = signed_multiply_32x16b(mult, sample12);
 		mult += inc;
@@ -176,8 +270,9 @@ void AudioEffectEnvelope::update(void)
 		mult_hires += inc_hires;
 		count--;
 	}
-	transmit(block);
-	release(block);
+	transmit(out);
+	release(out);
+	if (out != block) release(block);
 }
 
 bool AudioEffectEnvelope::isActive()
@@ -29,6 +29,7 @@
 #include "Arduino.h"
 #include "AudioStream.h"
 #include "utility/dspinst.h"
+#include "utility/event_queue.h"
 
 #define SAMPLES_PER_MSEC (AUDIO_SAMPLE_RATE_EXACT/1000.0f)
 
@@ -47,6 +48,13 @@ public:
 	}
 	void noteOn();
 	void noteOff();
+	// begin or end the note at an exact sample, see AudioEventTime()
+	bool noteOn(uint32_t time) {
+		return events.add(time, EVENT_NOTE_ON, 0, 0.0f);
+	}
+	bool noteOff(uint32_t time) {
+		return events.add(time, EVENT_NOTE_OFF, 0, 0.0f);
+	}
 	void delay(float milliseconds) {
 		delay_count = milliseconds2count(milliseconds);
 	}
@@ -79,6 +87,12 @@ public:
 	using AudioStream::release;
 	virtual void update(void);
 private:
+	enum { EVENT_NOTE_ON, EVENT_NOTE_OFF };
+	void note_on(void);
+	void note_off(void);
+	bool next_stage(void);
+	void apply_event(void);
+	void process(const int16_t *in, int16_t *out, unsigned int len);
 	uint16_t milliseconds2count(float milliseconds) {
 		if (milliseconds < 0.0f) milliseconds = 0.0f;
 		uint32_t c = ((uint32_t)(milliseconds*SAMPLES_PER_MSEC)+7)>>3;
@@ -101,6 +115,7 @@ private:
 	uint16_t release_count;
 	uint16_t release_forced_count;
 
+	AudioEventQueue events;
 };
 
 #undef SAMPLES_PER_MSEC
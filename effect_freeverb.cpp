@@ -31,6 +31,14 @@
 #include <Arduino.h>
 #include "effect_freeverb.h"
 #include "utility/dspinst.h"
+#include "utility/tail.h"
+
+// The output is the internal 16 bit signal times 30, so a step of 30 is
+// the smallest change the tail can make.  Silence must last long enough
+// to flush the longest comb plus the allpass chain (right channel of the
+// stereo version).
+#define FREEVERB_TAIL_THRESHOLD 30
+#define FREEVERB_TAIL_BLOCKS ((1640 + 579 + 464 + 364 + 248 + AUDIO_BLOCK_SAMPLES - 1) / AUDIO_BLOCK_SAMPLES)
 
 AudioEffectFreeverb::AudioEffectFreeverb() : AudioStream(1, inputQueueArray)
 {
@@ -69,6 +77,7 @@ AudioEffectFreeverb::AudioEffectFreeverb() : AudioStream(1, inputQueueArray)
 	allpass2index = 0;
 	allpass3index = 0;
 	allpass4index = 0;
+	tail_count = FREEVERB_TAIL_BLOCKS;
 }
 
 
@@ -136,14 +145,19 @@ void AudioEffectFreeverb::update()
 	int16_t input, bufout, output;
 	int32_t sum;
 
+	block = receiveReadOnly(0);
+	if (block) {
+		tail_count = 0;
+	} else {
+		// without input, run only until the tail has decayed
+		if (tail_count >= FREEVERB_TAIL_BLOCKS) return;
+		block = &zeroblock;
+	}
 	outblock = allocate();
 	if (!outblock) {
-		audio_block_t *tmp = receiveReadOnly(0);
-		if (tmp) release(tmp);
+		if (block != &zeroblock) release((audio_block_t *)block);
 		return;
 	}
-	block = receiveReadOnly(0);
-	if (!block) block = &zeroblock;
 
 	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
 		// TODO: scale numerical range depending on roomsize & damping
@@ -222,6 +236,13 @@ void AudioEffectFreeverb::update()
 
 		outblock->data[i] = sat16(output * 30, 0);
 	}
+	if (block == &zeroblock) {
+		if (tail_quiet(outblock->data, FREEVERB_TAIL_THRESHOLD)) {
+			tail_count++;
+		} else {
+			tail_count = 0;
+		}
+	}
 	transmit(outblock);
 	release(outblock);
 	if (block != &zeroblock) release((audio_block_t *)block);
@@ -234,6 +255,12 @@ void AudioEffectFreeverb::update()
 }
 
 
+bool AudioEffectFreeverb::isActive(void)
+{
+	return *(volatile uint16_t *)&tail_count < FREEVERB_TAIL_BLOCKS;
+}
+
+
 AudioEffectFreeverbStereo::AudioEffectFreeverbStereo() : AudioStream(1, inputQueueArray)
 {
 	memset(comb1bufL, 0, sizeof(comb1bufL));
@@ -303,6 +330,7 @@ AudioEffectFreeverbStereo::AudioEffectFreeverbStereo() : AudioStream(1, inputQue
 	allpass2indexR = 0;
 	allpass3indexR = 0;
 	allpass4indexR = 0;
+	tail_count = FREEVERB_TAIL_BLOCKS;
 }
 
 void AudioEffectFreeverbStereo::update()
@@ -316,15 +344,21 @@ void AudioEffectFreeverbStereo::update()
 	int32_t sum;
 
 	block = receiveReadOnly(0);
+	if (block) {
+		tail_count = 0;
+	} else {
+		// without input, run only until the tail has decayed
+		if (tail_count >= FREEVERB_TAIL_BLOCKS) return;
+		block = &zeroblock;
+	}
 	outblockL = allocate();
 	outblockR = allocate();
 	if (!outblockL || !outblockR) {
 		if (outblockL) release(outblockL);
 		if (outblockR) release(outblockR);
-		if (block) release((audio_block_t *)block);
+		if (block != &zeroblock) release((audio_block_t *)block);
 		return;
 	}
-	if (!block) block = &zeroblock;
 
 	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
 		// TODO: scale numerical range depending on roomsize & damping
@@ -476,6 +510,14 @@ void AudioEffectFreeverbStereo::update()
 
 		outblockR->data[i] = sat16(outputL * 30, 0);
 	}
+	if (block == &zeroblock) {
+		if (tail_quiet(outblockL->data, FREEVERB_TAIL_THRESHOLD)
+		  && tail_quiet(outblockR->data, FREEVERB_TAIL_THRESHOLD)) {
+			tail_count++;
+		} else {
+			tail_count = 0;
+		}
+	}
 	transmit(outblockL, 0);
 	transmit(outblockR, 1);
 	release(outblockL);
@@ -489,5 +531,7 @@ void AudioEffectFreeverbStereo::update()
 #endif
 }
 
-
-
+bool AudioEffectFreeverbStereo::isActive(void)
+{
+	return *(volatile uint16_t *)&tail_count < FREEVERB_TAIL_BLOCKS;
+}
@@ -49,6 +49,8 @@ public:
 		combdamp2 = x2;
 		__enable_irq();
 	}
+	// true while input is present or the reverb tail is still audible
+	bool isActive(void);
 private:
 	audio_block_t *inputQueueArray[1];
 	int16_t comb1buf[1116];
@@ -86,6 +88,7 @@ private:
 	uint16_t allpass2index;
 	uint16_t allpass3index;
 	uint16_t allpass4index;
+	uint16_t tail_count;
 };
 
 
@@ -109,6 +112,8 @@ public:
 		combdamp2 = x2;
 		__enable_irq();
 	}
+	// true while input is present or the reverb tail is still audible
+	bool isActive(void);
 private:
 	audio_block_t *inputQueueArray[1];
 	int16_t comb1bufL[1116];
@@ -178,6 +183,7 @@ private:
 	uint16_t allpass2indexR;
 	uint16_t allpass3indexR;
 	uint16_t allpass4indexR;
+	uint16_t tail_count;
 };
 
 
@@ -26,16 +26,17 @@
 
 #include <Arduino.h>
 #include "effect_multiply.h"
+#include "utility/inplace.h"
 
 void AudioEffectMultiply::update(void)
 {
 #if defined(__ARM_ARCH_7EM__)
-	audio_block_t *blocka, *blockb;
-	uint32_t *pa, *pb, *end;
+	audio_block_t *blocka, *blockb, *out;
+	uint32_t *pa, *pb, *po, *end;
 	uint32_t a12, a34; //, a56, a78;
 	uint32_t b12, b34; //, b56, b78;
 
-	blocka = receiveWritable(0);
+	blocka = receiveReadOnly(0);
 	blockb = receiveReadOnly(1);
 	if (!blocka) {
 		if (blockb) release(blockb);
@@ -45,12 +46,29 @@ void AudioEffectMultiply::update(void)
 		release(blocka);
 		return;
 	}
+	// multiply is commutative, so write over whichever input is unshared.
+	// receiveWritable() used to copy a shared first input, so only
+	// writing over the second input avoids an allocation.
+	if (blocka->ref_count > 1 && blockb->ref_count == 1) {
+		out = blocka;
+		blocka = blockb;
+		blockb = out;
+		out = inplace_output(blocka, allocate);
+	} else {
+		out = writable_output(blocka, allocate);
+	}
+	if (!out) {
+		release(blocka);
+		release(blockb);
+		return;
+	}
 	pa = (uint32_t *)(blocka->data);
 	pb = (uint32_t *)(blockb->data);
+	po = (uint32_t *)(out->data);
 	end = pa + AUDIO_BLOCK_SAMPLES/2;
 	while (pa < end) {
-		a12 = *pa;
-		a34 = *(pa+1);
+		a12 = *pa++;
+		a34 = *pa++;
 		//a56 = *(pa+2); // 8 samples/loop should work, but crashes.
 		//a78 = *(pa+3); // why?!  maybe a compiler bug??
 		b12 = *pb++;
@@ -69,13 +87,14 @@ void AudioEffectMultiply::update(void)
 		//a78 = pack_16b_16b(
 		//	signed_saturate_rshift(multiply_16tx16t(a78, b78), 16, 15), 
 		//	signed_saturate_rshift(multiply_16bx16b(a78, b78), 16, 15));
-		*pa++ = a12;
-		*pa++ = a34;
-		//*pa++ = a56;
-		//*pa++ = a78;
+		*po++ = a12;
+		*po++ = a34;
+		//*po++ = a56;
+		//*po++ = a78;
 	}
-	transmit(blocka);
-	release(blocka);
+	transmit(out);
+	release(out);
+	if (out != blocka) release(blocka);
 	release(blockb);
 
 #elif defined(KINETISL)
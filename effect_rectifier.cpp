@@ -28,13 +28,9 @@
 #include "effect_rectifier.h"
 #include "utility/dspinst.h"
 
-void AudioEffectRectifier::update(void)
+static void rectify(int16_t *p, unsigned int len)
 {
-	audio_block_t *block = receiveWritable();
-	if (!block) return;
-
-	int16_t *p = block->data;
-	int16_t *end = block->data + AUDIO_BLOCK_SAMPLES;
+	int16_t *end = p + len;
 	while (p < end) {
 		int b = *p;
 		int t = *(p + 1);
@@ -45,6 +41,20 @@ void AudioEffectRectifier::update(void)
 		*(uint32_t *)p = pack_16b_16b(t, b);
 		p += 2;
 	}
+}
+
+void AudioEffectRectifier::update(void)
+{
+	audio_block_t *block = receiveWritable();
+	if (!block) return;
+
+	if (oversampler.factor() > 1) {
+		int16_t *os = oversampler.upsample(block->data);
+		rectify(os, oversampler.length());
+		oversampler.downsample(block->data);
+	} else {
+		rectify(block->data, AUDIO_BLOCK_SAMPLES);
+	}
 	transmit(block);
 	release(block);
 }
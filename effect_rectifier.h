@@ -29,14 +29,19 @@
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "Oversampler.h"
 
 class AudioEffectRectifier: public AudioStream
 {
 public:
 	AudioEffectRectifier(void) : AudioStream(1, inputQueueArray) {}
 	virtual void update(void);
+	bool oversample(unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM) {
+		return oversampler.begin(factor, quality);
+	}
 private:
 	audio_block_t *inputQueueArray[1];
+	Oversampler oversampler;
 };
 
 #endif
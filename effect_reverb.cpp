@@ -25,6 +25,7 @@
 #include <Arduino.h>
 #include "effect_reverb.h"
 #include "utility/dspinst.h"
+#include "utility/tail.h"
 #include "math_helper.h"
 
 void 
@@ -170,9 +171,19 @@ void
 AudioEffectReverb::update(void)
 {
   audio_block_t *block;
-
-  if (!(block = receiveWritable()))
-    return;
+  bool silent = false;
+
+  if (!(block = receiveWritable())) {
+    // without input, run only until the tail has decayed
+    if (tail_count >= REVERB_TAIL_BLOCKS)
+      return;
+    if (!(block = allocate()))
+      return;
+    memset(block->data, 0, sizeof(block->data));
+    silent = true;
+  } else {
+    tail_count = 0;
+  }
 
   if (!block->data)
     return;
@@ -201,6 +212,13 @@ AudioEffectReverb::update(void)
 
   arm_q31_to_q15(q31_buf, block->data, AUDIO_BLOCK_SAMPLES);
 
+  if (silent) {
+    if (tail_quiet(block->data, REVERB_TAIL_THRESHOLD))
+      tail_count++;
+    else
+      tail_count = 0;
+  }
+
   transmit(block, 0);
   release(block);
 }
@@ -54,6 +54,11 @@
 #define LPF3_DLY_SEC 0.04023
 #define LPF4_DLY_SEC 0.04414
 
+// without input, the tail runs until this many blocks have stayed
+// within the threshold, enough to flush the longest delay path
+#define REVERB_TAIL_THRESHOLD 2
+#define REVERB_TAIL_BLOCKS ((APF1_DLY_LEN + APF2_DLY_LEN + LPF4_DLY_LEN + APF3_DLY_LEN + AUDIO_BLOCK_SAMPLES - 1) / AUDIO_BLOCK_SAMPLES)
+
 
 class AudioEffectReverb : public AudioStream
 {
@@ -62,9 +67,14 @@ class AudioEffectReverb : public AudioStream
       init_comb_filters();
       clear_buffers();
       reverbTime(5.0);
+      tail_count = REVERB_TAIL_BLOCKS;
     }
     virtual void update(void);
     void reverbTime(float);
+    // true while input is present or the reverb tail is still audible
+    bool isActive(void) {
+      return *(volatile uint16_t *)&tail_count < REVERB_TAIL_BLOCKS;
+    }
 
   private:
     struct comb_apf {
@@ -113,6 +123,8 @@ class AudioEffectReverb : public AudioStream
     int32_t q31_buf[AUDIO_BLOCK_SAMPLES];
     int32_t sum_buf[AUDIO_BLOCK_SAMPLES];
     int32_t aux_buf[AUDIO_BLOCK_SAMPLES];
+
+    uint16_t tail_count;
 };
 
 #endif
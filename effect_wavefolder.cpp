@@ -23,6 +23,17 @@
 
 #include "effect_wavefolder.h"
 
+static inline int16_t fold (int32_t a12, int32_t b12)
+{
+  // scale upto 16 times input, so that can fold upto 16 times in each polarity
+  int32_t s1 = (a12 * b12 + 0x400) >> 11 ;
+  // if in a band where the sense needs to be reverse, detect this
+  bool flip1 = ((s1 + 0x8000) >> 16) & 1 ;
+  // reverse and truncate to 16 bits
+  s1 = 0xFFFF & (flip1 ? ~s1 : +s1) ;
+  return s1 ;
+}
+
 void AudioEffectWaveFolder::update()
 {
   audio_block_t * blocka = receiveWritable (0);
@@ -36,20 +47,32 @@ void AudioEffectWaveFolder::update()
   }
   int16_t * pa = blocka->data ;
   int16_t * pb = blockb->data ;
-  for (int i = 0 ; i < AUDIO_BLOCK_SAMPLES ; i++)
+  unsigned int factor = oversampler.factor() ;
+  if (factor > 1)
   {
-    int32_t a12 = pa[i];
-    int32_t b12 = pb[i];
-
-    // scale upto 16 times input, so that can fold upto 16 times in each polarity
-    int32_t s1 = (a12 * b12 + 0x400) >> 11 ;
-    // if in a band where the sense needs to be reverse, detect this
-    bool flip1 = ((s1 + 0x8000) >> 16) & 1 ;
-    // reverse and truncate to 16 bits
-    s1 = 0xFFFF & (flip1 ? ~s1 : +s1) ;
-
-    pa[i] = s1;
+    // fold at the higher rate, with the modulation input linearly
+    // interpolated across each group of oversampled points
+    int16_t * os = oversampler.upsample (pa) ;
+    int32_t b0 = prevmod ;
+    for (int i = 0 ; i < AUDIO_BLOCK_SAMPLES ; i++)
+    {
+      int32_t b1 = pb[i] ;
+      for (unsigned int j = 0 ; j < factor ; j++)
+      {
+        int32_t b12 = b0 + (b1 - b0) * (int32_t)(j + 1) / (int32_t)factor ;
+        *os = fold (*os, b12) ;
+        os++ ;
+      }
+      b0 = b1 ;
+    }
+    oversampler.downsample (pa) ;
+  }
+  else
+  {
+    for (int i = 0 ; i < AUDIO_BLOCK_SAMPLES ; i++)
+      pa[i] = fold (pa[i], pb[i]) ;
   }
+  prevmod = pb[AUDIO_BLOCK_SAMPLES-1] ;
   transmit(blocka);
   release(blocka);
   release(blockb);
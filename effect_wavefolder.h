@@ -26,15 +26,22 @@
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "Oversampler.h"
 
 class AudioEffectWaveFolder : public AudioStream
 {
 public:
-  AudioEffectWaveFolder() : AudioStream(2, inputQueueArray) {}
+  AudioEffectWaveFolder() : AudioStream(2, inputQueueArray), prevmod(0) {}
   virtual void update() ;
+  bool oversample (unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM)
+  {
+    return oversampler.begin (factor, quality) ;
+  }
 
 private:
   audio_block_t * inputQueueArray[2] ;
+  Oversampler oversampler ;
+  int16_t prevmod ;
 };
 
 #endif
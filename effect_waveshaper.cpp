@@ -53,6 +53,21 @@ void AudioEffectWaveshaper::shape(float* waveshape, int length)
   while (index >>= 1) --lerpshift;
 }
 
+void AudioEffectWaveshaper::process(int16_t *data, unsigned int len)
+{
+  uint16_t x, xa;
+  int16_t ya, yb;
+  for (unsigned int i = 0; i < len; i++) {
+    // bring int16_t data into uint16_t range
+    x = data[i] + 32768;
+    // lerp waveshape (from http://coranac.com/tonc/text/fixed.htm)
+    xa = x >> lerpshift;
+    ya = waveshape[xa];
+    yb = waveshape[xa + 1];
+    data[i] = ya + ((yb - ya) * (x - (xa << lerpshift)) >> lerpshift);
+  }
+}
+
 void AudioEffectWaveshaper::update(void)
 {
   if(!waveshape) return;
@@ -61,16 +76,14 @@ void AudioEffectWaveshaper::update(void)
   block = receiveWritable();
   if (!block) return;
 
-  uint16_t x, xa;
-  int16_t i, ya, yb;
-  for (i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
-    // bring int16_t data into uint16_t range
-    x = block->data[i] + 32768;
-    // lerp waveshape (from http://coranac.com/tonc/text/fixed.htm)
-    xa = x >> lerpshift;
-    ya = waveshape[xa];
-    yb = waveshape[xa + 1];
-    block->data[i] = ya + ((yb - ya) * (x - (xa << lerpshift)) >> lerpshift);
+  if (oversampler.factor() > 1) {
+    // run the shaper at the higher rate, so harmonics above
+    // Nyquist are filtered rather than aliased
+    int16_t *os = oversampler.upsample(block->data);
+    process(os, oversampler.length());
+    oversampler.downsample(block->data);
+  } else {
+    process(block->data, AUDIO_BLOCK_SAMPLES);
   }
 
   transmit(block);
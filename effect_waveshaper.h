@@ -27,6 +27,7 @@
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "Oversampler.h"
 
 class AudioEffectWaveshaper : public AudioStream
 {
@@ -35,8 +36,13 @@ class AudioEffectWaveshaper : public AudioStream
     ~AudioEffectWaveshaper();
     virtual void update(void);
     void shape(float* waveshape, int length);
+    bool oversample(unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM) {
+      return oversampler.begin(factor, quality);
+    }
   private:
+    void process(int16_t *data, unsigned int len);
     audio_block_t *inputQueueArray[1];
+    Oversampler oversampler;
     int16_t* waveshape;
     int16_t lerpshift;
 };
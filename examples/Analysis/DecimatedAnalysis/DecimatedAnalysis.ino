@@ -0,0 +1,51 @@
+// Run an analysis branch at a lower sample rate
+//
+// Audio from the audio shield Line-In passes to Line-Out, while a copy
+// is decimated by 4 (to about 11 kHz) for note frequency detection.
+// AudioAnalyzeNoteFrequency then runs only once every 4 updates, using
+// about 1/4 of the CPU time it would need at the full sample rate.
+//
+// Objects after the decimator see a sample rate 4 times lower, so the
+// frequency they report must be divided by 4.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+const int factor = 4;
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=120,120
+AudioFilterDecimate      decimate1;      //xy=300,200
+AudioAnalyzeNoteFrequency notefreq1;     //xy=500,200
+AudioOutputI2S           i2s2;           //xy=300,100
+AudioConnection          patchCord1(i2s1, 0, i2s2, 0);
+AudioConnection          patchCord2(i2s1, 1, i2s2, 1);
+AudioConnection          patchCord3(i2s1, 0, decimate1, 0);
+AudioConnection          patchCord4(decimate1, notefreq1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=120,240
+// GUItool: end automatically generated code
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(40);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  decimate1.begin(factor);
+  notefreq1.begin(0.15);
+}
+
+void loop() {
+  if (notefreq1.available()) {
+    float note = notefreq1.read() / factor;
+    float prob = notefreq1.probability();
+    Serial.printf("Note: %3.2f | Probability: %.2f | CPU: %d%%\n", note, prob,
+      notefreq1.processorUsageMax());
+  }
+}
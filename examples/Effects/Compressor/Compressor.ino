@@ -0,0 +1,58 @@
+// Compressor and Gate
+//
+// Stereo line input passes through a noise gate, then a compressor
+// and a limiter.  The gain reduction of each is printed to the Arduino
+// Serial Monitor, as a simple meter.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+
+AudioInputI2S            i2s1;
+AudioEffectGate          gate1;
+AudioEffectCompressor    comp1;
+AudioEffectLimiter       limit1;
+AudioOutputI2S           i2s2;
+AudioConnection          patchCord1(i2s1, 0, gate1, 0);
+AudioConnection          patchCord2(i2s1, 1, gate1, 1);
+AudioConnection          patchCord3(gate1, 0, comp1, 0);
+AudioConnection          patchCord4(gate1, 1, comp1, 1);
+AudioConnection          patchCord5(comp1, 0, limit1, 0);
+AudioConnection          patchCord6(comp1, 1, limit1, 1);
+AudioConnection          patchCord7(limit1, 0, i2s2, 0);
+AudioConnection          patchCord8(limit1, 1, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(12);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  gate1.threshold(-55.0);
+  gate1.hold(100.0);
+
+  comp1.threshold(-24.0);
+  comp1.ratio(3.0);
+  comp1.kneeWidth(10.0);
+  comp1.attack(10.0);
+  comp1.release(200.0);
+  comp1.detector(DYNAMICS_DETECT_RMS);
+  comp1.makeupGain(8.0);
+
+  limit1.threshold(-1.0);
+}
+
+void loop() {
+  Serial.print("gate: ");
+  Serial.print(gate1.gainReduction(), 1);
+  Serial.print(" dB, compressor: ");
+  Serial.print(comp1.gainReduction(), 1);
+  Serial.print(" dB, limiter: ");
+  Serial.print(limit1.gainReduction(), 1);
+  Serial.print(" dB, CPU: ");
+  Serial.print(AudioProcessorUsageMax());
+  Serial.println("%");
+  delay(200);
+}
@@ -0,0 +1,66 @@
+// Floating point audio processing, with a 32 bit I2S input and output
+//
+// A low shelf and high pass clean up the input, and a delay adds an
+// echo.  Everything between input and output stays in floating point,
+// so no resolution is lost converting to 16 bits between objects.
+//
+// Each time the knob on pin A2 is turned, the echo level changes.
+// The peak level is printed, which may exceed 1.0 inside a floating
+// point signal chain without distortion.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S32          i2s32in;        //xy=120,160
+AudioFilterBiquad_F32    biquad_f32;     //xy=280,160
+AudioEffectDelay_F32     delay_f32;      //xy=440,260
+AudioMixer4_F32          mixer_f32;      //xy=600,180
+AudioAnalyzePeak_F32     peak_f32;       //xy=780,260
+AudioOutputI2S32         i2s32out;       //xy=780,180
+AudioConnection_F32      patchCord1(i2s32in, 0, biquad_f32, 0);
+AudioConnection_F32      patchCord2(biquad_f32, 0, mixer_f32, 0);
+AudioConnection_F32      patchCord3(biquad_f32, 0, delay_f32, 0);
+AudioConnection_F32      patchCord4(delay_f32, 0, mixer_f32, 1);
+AudioConnection_F32      patchCord5(mixer_f32, 0, i2s32out, 0);
+AudioConnection_F32      patchCord6(mixer_f32, 0, i2s32out, 1);
+AudioConnection_F32      patchCord7(mixer_f32, 0, peak_f32, 0);
+AudioControlSGTL5000     sgtl5000_1;     //xy=120,260
+// GUItool: end automatically generated code
+
+void setup() {
+  Serial.begin(9600);
+  // the delay needs 1 block per 2.9 ms
+  AudioMemory_F32(120);
+
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  biquad_f32.setHighpass(0, 20);
+  biquad_f32.setLowShelf(1, 150, -6.0);
+  delay_f32.delay(0, 300);
+  mixer_f32.gain(0, 1.0);
+  mixer_f32.gain(1, 0.4);
+}
+
+elapsedMillis msec;
+
+void loop() {
+  if (msec > 200) {
+    msec = 0;
+    float knob = (float)analogRead(A2) / 1023.0;
+    mixer_f32.gain(1, knob);
+    if (peak_f32.available()) {
+      Serial.print("peak: ");
+      Serial.print(peak_f32.read());
+      Serial.print("  float blocks: ");
+      Serial.println(AudioMemoryUsageMax_F32());
+    }
+  }
+}
@@ -0,0 +1,58 @@
+// Oversampled distortion
+//
+// A high frequency sine wave is driven hard into a waveshaper.  Every
+// 5 seconds the waveshaper's oversampling factor changes between 1X
+// (off), 2X, 4X and 8X.  Without oversampling, the clipped harmonics
+// above 22 kHz fold back down as inharmonic tones.  Listen for those
+// disappearing as the factor increases, while the Arduino Serial
+// Monitor shows the CPU usage of each setting.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+
+AudioSynthWaveformSine   sine;
+AudioEffectWaveshaper    shaper;
+AudioOutputI2S           i2s1;
+AudioConnection          patchCord1(sine, shaper);
+AudioConnection          patchCord2(shaper, 0, i2s1, 0);
+AudioConnection          patchCord3(shaper, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;
+
+// a hard clipping curve, full scale output from half scale input
+float curve[17] = {
+  -1.0, -1.0, -1.0, -1.0, -1.0, -0.75, -0.5, -0.25, 0.0,
+  0.25, 0.5, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0
+};
+
+const unsigned int factors[4] = {1, 2, 4, 8};
+unsigned int which = 0;
+elapsedMillis msec;
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.3);
+  sine.frequency(3520);
+  sine.amplitude(0.9);
+  shaper.shape(curve, 17);
+  shaper.oversample(factors[which], OVERSAMPLE_QUALITY_MEDIUM);
+}
+
+void loop() {
+  if (msec >= 5000) {
+    msec = 0;
+    which = (which + 1) % 4;
+    shaper.oversample(factors[which], OVERSAMPLE_QUALITY_MEDIUM);
+    shaper.processorUsageMaxReset();
+  }
+  Serial.print("oversample ");
+  Serial.print(factors[which]);
+  Serial.print("X, waveshaper CPU: ");
+  Serial.print(shaper.processorUsage());
+  Serial.print("%, max: ");
+  Serial.print(shaper.processorUsageMax());
+  Serial.println("%");
+  delay(500);
+}
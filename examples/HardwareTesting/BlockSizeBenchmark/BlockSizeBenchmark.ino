@@ -0,0 +1,128 @@
+// Measure the CPU cycles per sample used by the most common audio
+// objects, to choose a block size for each product.
+//
+// Smaller blocks give lower latency, but every update() has some
+// fixed overhead, so the cost per sample rises as blocks get smaller.
+// The block size and sample rate are set when the whole program is
+// compiled.  Rebuild this example with a different AUDIO_BLOCK_SAMPLES
+// (16 to 512, a power of 2) to compare, for example with PlatformIO:
+//
+//   build_flags = -DAUDIO_BLOCK_SAMPLES=32
+//
+// No audio hardware is needed.  The objects are not connected to any
+// input or output, so this sketch calls each update() itself.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+
+AudioSynthWaveform       waveform1;
+AudioSynthWaveformSine   sine1;
+AudioFilterBiquad        biquad1;
+AudioFilterFIR           fir1;
+AudioFilterStateVariable filter1;
+AudioMixer4              mixer1;
+AudioEffectFreeverb      freeverb1;
+AudioAnalyzePeak         peak1;
+AudioAnalyzeFFT1024      fft1024;
+AudioEffectLimiter       limiter1;
+AudioModMatrix           modmatrix1;
+AudioFilterCrossover     crossover1;
+AudioFilterDecimate      decimate1;
+AudioConnection          patchCord1(waveform1, biquad1);
+AudioConnection          patchCord2(waveform1, fir1);
+AudioConnection          patchCord3(waveform1, 0, filter1, 0);
+AudioConnection          patchCord4(waveform1, 0, mixer1, 0);
+AudioConnection          patchCord5(sine1, 0, mixer1, 1);
+AudioConnection          patchCord6(waveform1, 0, mixer1, 2);
+AudioConnection          patchCord7(sine1, 0, mixer1, 3);
+AudioConnection          patchCord8(waveform1, freeverb1);
+AudioConnection          patchCord9(waveform1, peak1);
+AudioConnection          patchCord10(waveform1, fft1024);
+AudioConnection          patchCord11(waveform1, limiter1);
+AudioConnection          patchCord12(sine1, 0, modmatrix1, 0);
+AudioConnection          patchCord13(waveform1, crossover1);
+AudioConnection          patchCord14(waveform1, decimate1);
+
+// 100 tap lowpass, only the CPU time matters here
+short fir_coeffs[100];
+
+const int iterations = 2000;
+uint32_t cycles[12];
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial && millis() < 4000) ;
+  AudioMemory(1024 / AUDIO_BLOCK_SAMPLES + 32);
+
+  waveform1.begin(0.8, 440, WAVEFORM_SAWTOOTH);
+  sine1.amplitude(0.5);
+  sine1.frequency(1000);
+  for (int i=0; i < 4; i++) biquad1.setLowpass(i, 2000, 0.7071);
+  for (int i=0; i < 100; i++) fir_coeffs[i] = 327;
+  fir1.begin(fir_coeffs, 100);
+  filter1.frequency(1000);
+  freeverb1.roomsize(0.7);
+  modmatrix1.gain(0, 0, 1.0);
+  modmatrix1.controlRate(128);  // limited to one block when blocks are smaller
+  crossover1.bands(3);
+  crossover1.frequency(0, 300);
+  crossover1.frequency(1, 3000);
+  decimate1.begin(4);
+
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+}
+
+void measure(AudioStream &object, uint32_t &total) {
+  uint32_t begin = ARM_DWT_CYCCNT;
+  object.update();
+  total += ARM_DWT_CYCCNT - begin;
+}
+
+void print(const char *name, uint32_t total) {
+  float per_sample = (float)total / (float)(iterations * AUDIO_BLOCK_SAMPLES);
+  Serial.print(name);
+  Serial.print(per_sample, 2);
+  Serial.println(" cycles/sample");
+}
+
+void loop() {
+  memset(cycles, 0, sizeof(cycles));
+  for (int n=0; n < iterations; n++) {
+    // sources transmit new blocks, then each object consumes them
+    waveform1.update();
+    sine1.update();
+    measure(biquad1, cycles[0]);
+    measure(fir1, cycles[1]);
+    measure(filter1, cycles[2]);
+    measure(mixer1, cycles[3]);
+    measure(freeverb1, cycles[4]);
+    measure(peak1, cycles[5]);
+    measure(fft1024, cycles[6]);
+    measure(limiter1, cycles[7]);
+    measure(modmatrix1, cycles[8]);
+    measure(crossover1, cycles[9]);
+    measure(decimate1, cycles[10]);
+  }
+
+  Serial.print("AUDIO_BLOCK_SAMPLES = ");
+  Serial.print(AUDIO_BLOCK_SAMPLES);
+  Serial.print(", AUDIO_SAMPLE_RATE_EXACT = ");
+  Serial.print(AUDIO_SAMPLE_RATE_EXACT);
+  Serial.print(", F_CPU = ");
+  Serial.println(F_CPU);
+  print("  Biquad, 4 stages:     ", cycles[0]);
+  print("  FIR, 100 taps:        ", cycles[1]);
+  print("  State Variable:       ", cycles[2]);
+  print("  Mixer, 4 inputs:      ", cycles[3]);
+  print("  Freeverb:             ", cycles[4]);
+  print("  Peak:                 ", cycles[5]);
+  print("  FFT1024 (average):    ", cycles[6]);
+  print("  Limiter, look-ahead:  ", cycles[7]);
+  print("  Mod Matrix, control:  ", cycles[8]);
+  print("  Crossover, 3 bands:   ", cycles[9]);
+  print("  Decimate by 4:        ", cycles[10]);
+  Serial.println();
+  delay(5000);
+}
@@ -0,0 +1,57 @@
+/*
+ * Pass audio from the audio shield Line-In to Line-Out with all 32
+ * bits of each I2S sample, as floating point.  A converter feeds a
+ * copy to an ordinary 16 bit peak analyzer, to show how the floating
+ * point and 16 bit objects work together.
+ *
+ * For a CS42448 (or other TDM codec) use AudioInputTDM32 and
+ * AudioOutputTDM32, with AudioControlCS42448 instead of SGTL5000.
+ *
+ * This example code is in the public domain.
+ */
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S32          i2s32in;        //xy=180,120
+AudioOutputI2S32         i2s32out;       //xy=400,100
+AudioConvertF32toI16     convertF32toI16; //xy=400,180
+AudioAnalyzePeak         peak1;          //xy=600,180
+AudioConnection_F32      patchCord1(i2s32in, 0, i2s32out, 0);
+AudioConnection_F32      patchCord2(i2s32in, 1, i2s32out, 1);
+AudioConnection_F32      patchCord3(i2s32in, 0, convertF32toI16, 0);
+AudioConnection          patchCord4(convertF32toI16, peak1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=180,240
+// GUItool: end automatically generated code
+
+void setup() {
+  // 16 bit blocks are still needed for the converter and analyzer
+  AudioMemory(4);
+  // floating point blocks are used by the 32 bit I2S objects
+  AudioMemory_F32(8);
+
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+  convertF32toI16.dither(true);
+}
+
+elapsedMillis msec;
+
+void loop() {
+  if (msec > 250) {
+    msec = 0;
+    if (peak1.available()) {
+      Serial.print("peak: ");
+      Serial.print(peak1.read());
+    }
+    Serial.print("  float blocks: ");
+    Serial.print(AudioMemoryUsageMax_F32());
+    Serial.print("  CPU: ");
+    Serial.println(AudioProcessorUsageMax());
+  }
+}
@@ -0,0 +1,216 @@
+// Measure the CPU cycles used to interleave and deinterleave
+// audio for TDM and multi-pin I2S, as done in each DMA interrupt.
+//
+// The optimized copy functions used by AudioOutputTDM,
+// AudioInputTDM, AudioOutputI2SHex, AudioOutputI2SOct, the
+// multi-channel I2S inputs and the 32 bit float TDM & I2S objects
+// are compared to simple C loops.  Each optimized result is also
+// checked against the simple loop's, and PASS or FAIL is printed.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include "memcpy_audio.h"
+
+int16_t channel[16][AUDIO_BLOCK_SAMPLES] __attribute__((aligned(4)));
+int16_t received[16][AUDIO_BLOCK_SAMPLES] __attribute__((aligned(4)));
+int16_t expected[16][AUDIO_BLOCK_SAMPLES] __attribute__((aligned(4)));
+float fchannel[8][AUDIO_BLOCK_SAMPLES];
+float freceived[8][AUDIO_BLOCK_SAMPLES];
+float fexpected[8][AUDIO_BLOCK_SAMPLES];
+uint32_t buffer[AUDIO_BLOCK_SAMPLES * 8];
+uint32_t reference[AUDIO_BLOCK_SAMPLES * 8];
+
+// simple C loops, the same work as the optimized functions
+void simple_tdm_tx16(uint32_t *dest, const int16_t *src1, const int16_t *src2) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    *dest = ((uint32_t)src1[i] << 16) | (uint16_t)src2[i];
+    dest += 8;
+  }
+}
+
+void simple_tdm_rx16(int16_t *dest1, int16_t *dest2, const uint32_t *src) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    dest1[i] = *src >> 16;
+    dest2[i] = *src;
+    src += 8;
+  }
+}
+
+void simple_tdm_tx32(uint32_t *dest, const int16_t *src) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    *dest = (uint32_t)src[i] << 16;
+    dest += 8;
+  }
+}
+
+void simple_tdm_rx32(int16_t *dest, const uint32_t *src) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    dest[i] = *src >> 16;
+    src += 8;
+  }
+}
+
+void simple_tdm_tx_f32(uint32_t *dest, const float *src) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    float n = src[i] * 2147483648.0f;
+    if (n > 2147483520.0f) n = 2147483520.0f;
+    if (n < -2147483648.0f) n = -2147483648.0f;
+    *dest = (int32_t)n;
+    dest += 8;
+  }
+}
+
+void simple_tdm_rx_f32(float *dest, const uint32_t *src) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    dest[i] = (int32_t)*src / 2147483648.0f;
+    src += 8;
+  }
+}
+
+void simple_tointerleave(int16_t *dest, const int16_t * const *src, int pins) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
+    for (int p=0; p < pins; p++) *dest++ = src[p*2][i];
+    for (int p=0; p < pins; p++) *dest++ = src[p*2+1][i];
+  }
+}
+
+void simple_frominterleave(int16_t * const *dest, const int16_t *src, int pins) {
+  for (int i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
+    for (int p=0; p < pins; p++) dest[p*2][i] = *src++;
+    for (int p=0; p < pins; p++) dest[p*2+1][i] = *src++;
+  }
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial && millis() < 4000) ;
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+  for (int c=0; c < 16; c++) {
+    for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+      channel[c][i] = random(-32768, 32767);
+    }
+  }
+  for (int c=0; c < 8; c++) {
+    for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+      fchannel[c][i] = random(-32768, 32767) / 32768.0f;
+    }
+    fchannel[c][c] = 1.5f;    // beyond full scale, must clip
+    fchannel[c][c + 8] = -1.5f;
+  }
+}
+
+uint32_t cycles;
+#define BEGIN()  __disable_irq(); cycles = ARM_DWT_CYCCNT
+#define END(name) cycles = ARM_DWT_CYCCNT - cycles; __enable_irq(); \
+  Serial.print(name); Serial.print(": "); Serial.println(cycles)
+
+// Before each pair of runs, the two results are filled with different
+// patterns, so anything not written by both copies will not match
+int failures = 0;
+void prepare(void *result, void *simple, size_t size) {
+  memset(result, 0x55, size);
+  memset(simple, 0xAA, size);
+}
+void check(const char *name, const void *result, const void *simple, size_t size) {
+  bool ok = (memcmp(result, simple, size) == 0);
+  if (!ok) failures++;
+  Serial.print(name);
+  Serial.println(ok ? ": PASS" : ": FAIL");
+}
+
+void loop() {
+  const int16_t *src[8];
+  int16_t *dest[8], *ref[8];
+  for (int c=0; c < 8; c++) {
+    // I2S copies half a block per channel in each interrupt,
+    // so the received halves are packed one after another
+    src[c] = channel[c];
+    dest[c] = received[0] + c * AUDIO_BLOCK_SAMPLES/2;
+    ref[c] = expected[0] + c * AUDIO_BLOCK_SAMPLES/2;
+  }
+  failures = 0;
+
+  Serial.println("CPU cycles per interrupt:");
+  prepare(buffer, reference, sizeof(buffer));
+  BEGIN();
+  for (int i=0; i < 16; i += 2) simple_tdm_tx16(reference + i/2, channel[i], channel[i+1]);
+  END("  TDM 16 ch output, simple");
+  BEGIN();
+  for (int i=0; i < 16; i += 2) memcpy_tdm_tx16(buffer + i/2, channel[i], channel[i+1], 8, AUDIO_BLOCK_SAMPLES);
+  END("  TDM 16 ch output, optimized");
+  check("  TDM 16 ch output", buffer, reference, sizeof(buffer));
+  prepare(received, expected, sizeof(received));
+  BEGIN();
+  for (int i=0; i < 16; i += 2) simple_tdm_rx16(expected[i], expected[i+1], buffer + i/2);
+  END("  TDM 16 ch input, simple");
+  BEGIN();
+  for (int i=0; i < 16; i += 2) memcpy_tdm_rx16(received[i], received[i+1], buffer + i/2, 8, AUDIO_BLOCK_SAMPLES);
+  END("  TDM 16 ch input, optimized");
+  check("  TDM 16 ch input", received, expected, sizeof(received));
+
+  prepare(buffer, reference, sizeof(buffer));
+  BEGIN();
+  for (int i=0; i < 8; i++) simple_tdm_tx32(reference + i, channel[i]);
+  END("  TDM 32 bit 8 ch output, simple");
+  BEGIN();
+  for (int i=0; i < 8; i++) memcpy_tdm_tx32(buffer + i, channel[i], 8, AUDIO_BLOCK_SAMPLES);
+  END("  TDM 32 bit 8 ch output, optimized");
+  check("  TDM 32 bit 8 ch output", buffer, reference, sizeof(buffer));
+  prepare(received, expected, sizeof(received[0]) * 8);
+  BEGIN();
+  for (int i=0; i < 8; i++) simple_tdm_rx32(expected[i], buffer + i);
+  END("  TDM 32 bit 8 ch input, simple");
+  BEGIN();
+  for (int i=0; i < 8; i++) memcpy_tdm_rx32(received[i], buffer + i, 8, AUDIO_BLOCK_SAMPLES);
+  END("  TDM 32 bit 8 ch input, optimized");
+  check("  TDM 32 bit 8 ch input", received, expected, sizeof(received[0]) * 8);
+
+  prepare(buffer, reference, sizeof(buffer));
+  BEGIN();
+  for (int i=0; i < 8; i++) simple_tdm_tx_f32(reference + i, fchannel[i]);
+  END("  TDM float 8 ch output, simple");
+  BEGIN();
+  for (int i=0; i < 8; i++) memcpy_tdm_tx_f32(buffer + i, fchannel[i], 8, AUDIO_BLOCK_SAMPLES);
+  END("  TDM float 8 ch output, optimized");
+  check("  TDM float 8 ch output", buffer, reference, sizeof(buffer));
+  prepare(freceived, fexpected, sizeof(freceived));
+  BEGIN();
+  for (int i=0; i < 8; i++) simple_tdm_rx_f32(fexpected[i], buffer + i);
+  END("  TDM float 8 ch input, simple");
+  BEGIN();
+  for (int i=0; i < 8; i++) memcpy_tdm_rx_f32(freceived[i], buffer + i, 8, AUDIO_BLOCK_SAMPLES);
+  END("  TDM float 8 ch input, optimized");
+  check("  TDM float 8 ch input", freceived, fexpected, sizeof(freceived));
+
+  for (int pins=2; pins <= 4; pins++) {
+    char name[40];
+    size_t size = AUDIO_BLOCK_SAMPLES/2 * pins * 2 * sizeof(int16_t);
+    prepare(buffer, reference, size);
+    BEGIN();
+    simple_tointerleave((int16_t *)reference, src, pins);
+    sprintf(name, "  I2S %d ch output, simple", pins * 2);
+    END(name);
+    BEGIN();
+    memcpy_tointerleave_pins((int16_t *)buffer, src, pins, AUDIO_BLOCK_SAMPLES/2);
+    sprintf(name, "  I2S %d ch output, optimized", pins * 2);
+    END(name);
+    sprintf(name, "  I2S %d ch output", pins * 2);
+    check(name, buffer, reference, size);
+    prepare(received, expected, size);
+    BEGIN();
+    simple_frominterleave(ref, (int16_t *)buffer, pins);
+    sprintf(name, "  I2S %d ch input, simple", pins * 2);
+    END(name);
+    BEGIN();
+    memcpy_frominterleave_pins(dest, (int16_t *)buffer, pins, AUDIO_BLOCK_SAMPLES/2);
+    sprintf(name, "  I2S %d ch input, optimized", pins * 2);
+    END(name);
+    sprintf(name, "  I2S %d ch input", pins * 2);
+    check(name, received, expected, size);
+  }
+  Serial.println(failures ? "Some results FAIL" : "All results PASS");
+  Serial.println();
+  delay(5000);
+}
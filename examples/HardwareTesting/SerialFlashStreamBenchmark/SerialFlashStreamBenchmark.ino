@@ -0,0 +1,93 @@
+// Compare the CPU time AudioPlaySerialflashRaw uses reading a file
+// through the SerialFlash library, against playing the same kind of data
+// directly from memory, like PSRAM or QSPI flash on Teensy 4.1, and
+// estimate how many streams could play at once each way.
+//
+// For the SerialFlash test, copy a RAW file to the flash chip first,
+// with File > Examples > SerialFlash > CopyFromSD.  Without it, only
+// the memory test runs.  On Teensy 4.1 with PSRAM soldered to the
+// bottom pads, the memory test data is placed in PSRAM (EXTMEM).
+//
+// The players are not connected to any output, so this sketch calls
+// each update() itself.  The estimate leaves 20% of the CPU for the
+// rest of the audio library and the sketch.  Reading the SPI flash
+// also keeps the SPI bus busy, which limits streams even when CPU
+// time remains.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <SPI.h>
+#include <SerialFlash.h>
+
+#define FLASH_CHIP_SELECT  6
+#define FILENAME  "SDTEST1.RAW"
+
+#ifndef F_CPU_ACTUAL
+#define F_CPU_ACTUAL F_CPU
+#endif
+
+#if defined(ARDUINO_TEENSY41)
+#define SAMPLES 441000  // 10 seconds, in PSRAM when fitted
+EXTMEM int16_t sample_data[SAMPLES];
+#else
+#define SAMPLES 8192
+int16_t sample_data[SAMPLES];
+#endif
+
+AudioPlaySerialflashRaw  player;
+
+const int iterations = 1000;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial && millis() < 4000) ;
+  AudioMemory(10);
+
+  for (int i=0; i < SAMPLES; i++) {
+    sample_data[i] = sinf(i * 0.0627f) * 16000.0f;
+  }
+  SPI.setMOSI(7);
+  SPI.setSCK(14);
+  if (!SerialFlash.begin(FLASH_CHIP_SELECT)) {
+    Serial.println("Unable to access SPI Flash chip");
+  }
+
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+}
+
+// play in a loop, so every update has a full block to read
+uint32_t measure(void) {
+  uint32_t total = 0;
+  player.setLoop(0);
+  player.play();
+  for (int n=0; n < iterations; n++) {
+    uint32_t begin = ARM_DWT_CYCCNT;
+    player.update();
+    total += ARM_DWT_CYCCNT - begin;
+  }
+  player.stop();
+  return total / iterations;
+}
+
+void print(const char *name, uint32_t cycles) {
+  float block_cycles = (float)F_CPU_ACTUAL * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT;
+  Serial.print(name);
+  Serial.print(cycles);
+  Serial.print(" cycles/update, about ");
+  Serial.print((int)(block_cycles * 0.8f / cycles));
+  Serial.println(" streams");
+}
+
+void loop() {
+  if (player.cue(FILENAME)) {
+    print("SerialFlash file over SPI: ", measure());
+  } else {
+    Serial.println("SerialFlash file " FILENAME " not found");
+  }
+  player.cue(sample_data, sizeof(sample_data));
+  print("Memory mapped data:        ", measure());
+  Serial.println();
+  delay(5000);
+}
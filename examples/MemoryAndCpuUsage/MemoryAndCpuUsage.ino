@@ -7,6 +7,12 @@
 // The total CPU usage, and CPU usage for each object can
 // be monitored.  Reset functions clear the maximums.
 //
+// Objects which process a block nobody else is using write
+// their output directly over it.  The number of times this
+// avoided allocating a new block is also shown.  Here pink1
+// feeds only envelope1, so its blocks are reused, but sine1
+// also feeds fft256_1, so envelope2 must allocate.
+//
 // Use the Arduino Serial Monitor to view the usage info
 // and control ('F', 'S', and 'R' keys) this program.
 //
@@ -112,6 +118,7 @@ void loop() {
       fft256_1.processorUsageMaxReset();
       AudioProcessorUsageMaxReset();
       AudioMemoryUsageMaxReset();
+      AudioMemoryInPlaceReset();
       Serial.println("Reset all max numbers");
     }
     if ((c == 'f' || c == 'F') && speed > 16) {
@@ -144,6 +151,9 @@ void loop() {
   Serial.print(",");
   Serial.print(AudioMemoryUsageMax());
   Serial.print("    ");
+  Serial.print("In place: ");
+  Serial.print(AudioMemoryInPlace());
+  Serial.print("    ");
   Serial.print("Send: (R)eset, (S)lower, (F)aster");
   Serial.println();
 
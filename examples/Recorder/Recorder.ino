@@ -151,19 +151,16 @@ void startRecording() {
 }
 
 void continueRecording() {
-  if (queue1.available() >= 2) {
-    byte buffer[512];
-    // Fetch 2 blocks from the audio library and copy
-    // into a 512 byte buffer.  The Arduino SD library
-    // is most efficient when full 512 byte sector size
-    // writes are used.
-    memcpy(buffer, queue1.readBuffer(), 256);
-    queue1.freeBuffer();
-    memcpy(buffer+256, queue1.readBuffer(), 256);
-    queue1.freeBuffer();
+  if (queue1.available() * AUDIO_BLOCK_SAMPLES >= 256) {
+    int16_t buffer[256];
+    // Copy 256 samples from the audio library into a
+    // 512 byte buffer.  The Arduino SD library is most
+    // efficient when full 512 byte sector size writes
+    // are used.
+    queue1.read(buffer, 256);
     // write all 512 bytes to the SD card
     //elapsedMicros usec = 0;
-    frec.write(buffer, 512);
+    frec.write((byte *)buffer, 512);
     // Uncomment these lines to see how long SD writes
     // are taking.  A pair of audio blocks arrives every
     // 5802 microseconds, so hopefully most of the writes
@@ -183,11 +180,16 @@ void stopRecording() {
   Serial.println("stopRecording");
   queue1.end();
   if (mode == 1) {
-    while (queue1.available() > 0) {
-      frec.write((byte*)queue1.readBuffer(), 256);
-      queue1.freeBuffer();
+    int16_t buffer[256];
+    uint32_t count;
+    while ((count = queue1.read(buffer, 256)) > 0) {
+      frec.write((byte *)buffer, count * 2);
     }
     frec.close();
+    if (queue1.dropped() > 0) {
+      Serial.print("audio blocks lost: ");
+      Serial.println(queue1.dropped());
+    }
   }
   mode = 0;
 }
@@ -0,0 +1,187 @@
+// Record stereo sound as a WAV file on a SD card, and play it back.
+//
+// Unlike the Recorder example, AudioRecordSdWav buffers audio in a
+// large RAM buffer and writes to the card in big pieces, so brief
+// card stalls do not lose audio.
+//
+// Requires the audio shield:
+//   http://www.pjrc.com/store/teensy3_audio.html
+//
+// Three pushbuttons need to be connected:
+//   Record Button: pin 0 to GND
+//   Stop Button:   pin 1 to GND
+//   Play Button:   pin 2 to GND
+//
+// This example code is in the public domain.
+
+#include <Bounce.h>
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s2;           //xy=105,63
+AudioRecordSdWav         recordWav1;     //xy=281,63
+AudioPlaySdWav           playWav1;       //xy=302,157
+AudioOutputI2S           i2s1;           //xy=470,120
+AudioConnection          patchCord1(i2s2, 0, recordWav1, 0);
+AudioConnection          patchCord2(i2s2, 1, recordWav1, 1);
+AudioConnection          patchCord3(playWav1, 0, i2s1, 0);
+AudioConnection          patchCord4(playWav1, 1, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=265,212
+// GUItool: end automatically generated code
+
+// Bounce objects to easily and reliably read the buttons
+Bounce buttonRecord = Bounce(0, 8);
+Bounce buttonStop =   Bounce(1, 8);  // 8 = 8 ms debounce time
+Bounce buttonPlay =   Bounce(2, 8);
+
+
+// which input on the audio shield will be used?
+const int myInput = AUDIO_INPUT_LINEIN;
+//const int myInput = AUDIO_INPUT_MIC;
+
+
+// Use these with the Teensy Audio Shield
+#define SDCARD_CS_PIN    10
+#define SDCARD_MOSI_PIN  7
+#define SDCARD_SCK_PIN   14
+
+// Use these with the Teensy 3.5 & 3.6 SD card
+//#define SDCARD_CS_PIN    BUILTIN_SDCARD
+//#define SDCARD_MOSI_PIN  11  // not actually used
+//#define SDCARD_SCK_PIN   13  // not actually used
+
+// Use these for the SD+Wiz820 or other adaptors
+//#define SDCARD_CS_PIN    4
+//#define SDCARD_MOSI_PIN  11
+//#define SDCARD_SCK_PIN   13
+
+
+// Remember which mode we're doing
+int mode = 0;  // 0=stopped, 1=recording, 2=playing
+
+elapsedMillis statusTime;
+
+void setup() {
+  // Configure the pushbutton pins
+  pinMode(0, INPUT_PULLUP);
+  pinMode(1, INPUT_PULLUP);
+  pinMode(2, INPUT_PULLUP);
+
+  // The recorder has its own buffer, so only a few
+  // audio blocks are needed
+  AudioMemory(12);
+
+  // Enable the audio shield, select input, and enable output
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(myInput);
+  sgtl5000_1.volume(0.5);
+
+  // Initialize the SD card
+  SPI.setMOSI(SDCARD_MOSI_PIN);
+  SPI.setSCK(SDCARD_SCK_PIN);
+  if (!(SD.begin(SDCARD_CS_PIN))) {
+    // stop here if no SD card, but print a message
+    while (1) {
+      Serial.println("Unable to access the SD card");
+      delay(500);
+    }
+  }
+}
+
+
+void loop() {
+  // First, read the buttons
+  buttonRecord.update();
+  buttonStop.update();
+  buttonPlay.update();
+
+  // Respond to button presses
+  if (buttonRecord.fallingEdge()) {
+    Serial.println("Record Button Press");
+    if (mode == 2) stopPlaying();
+    if (mode == 0) startRecording();
+  }
+  if (buttonStop.fallingEdge()) {
+    Serial.println("Stop Button Press");
+    if (mode == 1) stopRecording();
+    if (mode == 2) stopPlaying();
+  }
+  if (buttonPlay.fallingEdge()) {
+    Serial.println("Play Button Press");
+    if (mode == 1) stopRecording();
+    if (mode == 0) startPlaying();
+  }
+
+  // If we're playing or recording, carry on...
+  if (mode == 1) {
+    continueRecording();
+  }
+  if (mode == 2) {
+    continuePlaying();
+  }
+}
+
+
+void startRecording() {
+  Serial.println("startRecording");
+  // reserve space for 10 minutes, so the card
+  // does not need to update the FAT while recording
+  if (recordWav1.begin("RECORD.WAV", 2, 600)) {
+    mode = 1;
+  }
+}
+
+void continueRecording() {
+  // write any buffered audio to the card
+  recordWav1.service();
+  if (!recordWav1.isRecording()) {
+    // card full or removed
+    stopRecording();
+    return;
+  }
+  if (statusTime > 1000) {
+    statusTime = 0;
+    Serial.print("seconds: ");
+    Serial.print(recordWav1.lengthMillis() / 1000);
+    Serial.print(", slowest write (us): ");
+    Serial.print(recordWav1.writeMicrosMax());
+    Serial.print(", buffer used: ");
+    Serial.print(recordWav1.bufferUsedMax());
+    Serial.print(" of ");
+    Serial.println(recordWav1.bufferSize());
+  }
+}
+
+void stopRecording() {
+  Serial.println("stopRecording");
+  recordWav1.end();
+  if (recordWav1.dropped() > 0) {
+    Serial.print("audio blocks lost: ");
+    Serial.println(recordWav1.dropped());
+  }
+  mode = 0;
+}
+
+
+void startPlaying() {
+  Serial.println("startPlaying");
+  playWav1.play("RECORD.WAV");
+  mode = 2;
+}
+
+void continuePlaying() {
+  if (!playWav1.isPlaying()) {
+    playWav1.stop();
+    mode = 0;
+  }
+}
+
+void stopPlaying() {
+  Serial.println("stopPlaying");
+  if (mode == 2) playWav1.stop();
+  mode = 0;
+}
@@ -0,0 +1,94 @@
+// Audio data converted from WAV file by wav2sketch
+
+#include <Arduino.h>
+#include "AudioSampleKick.h"
+
+// Converted from kick.wav, using 22050 Hz, IMA-ADPCM encoding
+PROGMEM const unsigned int AudioSampleKick[681] = {
+0x420013EC,0x00000000,0xF27AF7F7,0x4CA9704E,0x160B18F3,0x9A239AA0,0x9129F011,0xB2DA835A,
+0x38BB1410,0x319F020A,0x318E8708,0x08B158AA,0x4219A807,0x928029A9,0x291C9B08,0xA9F0A9D2,
+0x1A1F188A,0x96C19909,0x0043C6DD,0x831A0280,0x022A217A,0x22080443,0x11B10526,0x4C200113,
+0x3B1E1A92,0xA0CAAD89,0xC8B9CD9A,0xE9BCA9AA,0x1E8A98B9,0x800A0C09,0x0A03A182,0x06843278,
+0x32040401,0x23204851,0x84305833,0x003B3263,0x20050214,0x82814938,0x1988A5C3,0x8F9CB81A,
+0xBF2AB999,0x8CA809E9,0xDABB9BA8,0x9DCBA9B8,0x8AC8BAA9,0xA909AA0E,0x81C0919A,0x23972820,
+0x68342522,0x31171132,0x31415322,0x13115041,0x00381799,0x23961403,0x03403121,0x4A681106,
+0x18100108,0xC2B49180,0xABBA99B0,0xB9B98FAF,0xADABCB9C,0xCBBABDAB,0xBCBABACA,0xB8C8DBBA,
+0x8C9B9BB8,0xA9AA8BAC,0xB1B80E99,0x15183830,0x42148705,0x003597F5,0x53433140,0x22316322,
+0x22413216,0x05032414,0x71313113,0x82284921,0x58928301,0xC4929910,0x80A0A292,0x899F892C,
+0xECBC8CAB,0xABCBBAA8,0xBBADAB9E,0xABBAB9E9,0x99D9BB8E,0xBABA9ACA,0x0034B6A5,0xAC8CACAB,
+0xA0BC8AB8,0x881F1A89,0x9392F380,0x083A6910,0x24B51310,0x42302858,0x22152420,0x43242206,
+0x41324412,0x33243242,0x32314252,0x06401343,0x00481011,0x20111401,0xA4810828,0x002B735A,
+0x0E39F0B8,0xB880B919,0x0D2A90F8,0xBAA9990D,0xB8F8BEBA,0xBADBBAAA,0xCAACACAC,0xADACBBBA,
+0xBBBCBBAB,0xB9B9DABC,0xA89CAA8C,0xC1B0D99B,0x9A191C88,0x210896A0,0x95302960,0x72201143,
+0x0032A24A,0x85210048,0x70122483,0x32850230,0x24223105,0x33136233,0x31414253,0x15223242,
+0x32131205,0x63232332,0x38404821,0x93948381,0x9B0B2012,0x9AF3FA0B,0x0C9BAC89,0xD9AA9B0F,
+0x9EACAAAA,0x00324667,0xC8EC9BBA,0xCABBB8B8,0xBAAA9EBA,0xBAD9BAAD,0xBBACACAB,0xAADBBBAC,
+0xB9CABACB,0x88E0BCAB,0xE80B0B9A,0x9B092B90,0x484C1810,0x33939798,0x37934112,0x10415138,
+0x06134024,0x24314222,0x0031CE54,0x34312523,0x22425332,0x33434333,0x32424334,0x43243324,
+0x23422432,0x13225323,0x30312206,0x22393141,0x1085A411,0x0F089199,0xB1F8C08C,0x9D0C9BA0,
+0xBD8BCAAA,0xAACADBAA,0xC9B99FAB,0x00322EE8,0xCABB9C9B,0xCCBBBACA,0xCBBBACAA,0xACACABCB,
+0xBDAABCAB,0xACBB9CB9,0xCACABACA,0xACBABBA9,0xCB9BACBB,0x8E899C9B,0xA88098A8,0x122030A2,
+0x45332857,0x33415330,0x33153532,0x33243253,0x002AC119,0x33252335,0x51343225,0x42343322,
+0x32434333,0x24343334,0x43242343,0x41353332,0x43243332,0x42334332,0x15322433,0x22422322,
+0x12052322,0x29183021,0x9BD8D91B,0xABDACBCC,0xCBB9DACC,0x002954FF,0xACBCBBCA,0xBCBBACBC,
+0xBCBBBCAC,0xDBBBCBBC,0xABCBBACA,0xBACACBBC,0xACCBBBCB,0xBBACACBB,0xBBBCBBCB,0xCBBBBACC,
+0xABCBABAC,0xACBBBBAC,0xBBBACBBB,0xBAAAAACA,0x10088A99,0x35433722,0x001F9AA4,0x34343263,
+0x34343434,0x43242443,0x24244333,0x33343243,0x33433434,0x42434334,0x34343332,0x33343433,
+0x23423434,0x43324324,0x34332432,0x32433242,0x32242433,0x23322423,0x22222224,0x001E6428,
+0x88001122,0xBCCCBDAA,0xDBBCCBCC,0xCACCBCBB,0xCBCBBCBA,0xBCBACACB,0xBCBACCBB,0xCBBCBCBB,
+0xBBCBBCBB,0xCBCBBBAD,0xCACBCBBB,0xCBBBCBBA,0xABCBBCBB,0xCBBCBBBC,0xBACABCBA,0xBCBBBCBB,
+0x0028B50B,0xACBBBACA,0xABBACBBB,0xAABAAAAC,0x9089A9AA,0x43635331,0x43424443,0x34253343,
+0x34334343,0x33433434,0x33343244,0x24243434,0x33433433,0x33432443,0x43343343,0x33343243,
+0x33242434,0x002B1B9A,0x43433343,0x43334333,0x33224243,0x33324234,0x33433334,0x32433324,
+0x22433323,0x11022132,0xCBFBBA09,0xDBCBCCCB,0xBCBCBBCA,0xCBBCBACC,0xBCBBCBCB,0xBBACACCB,
+0xBCBBCBBC,0xBACCBBBC,0x002B1BAB,0xCBBBCBAC,0xCBCBBCBB,0xBBCBCBBB,0xCBBBCBCB,0xBBCBBCBB,
+0xACABCBAC,0xBACABCBB,0xBBCBABCB,0xBCBBBCBB,0xACABCBBB,0xABABBABA,0x0999AABB,0x33562320,
+0x34244354,0x34335334,0x24324244,0x0027B613,0x34332424,0x34334334,0x43253334,0x33434333,
+0x32432443,0x33343343,0x43343325,0x33433433,0x32424343,0x32434333,0x43243324,0x33343332,
+0x33332424,0x33243343,0x42332433,0x12222231,0x001756C4,0x8C890293,0xCACCCBCC,0xCCBBDBBC,
+0xBCBBCACB,0xCBCBBCBC,0xBCBACACB,0xCBBCBBCB,0xBCBACBAC,0xBBBCBCBB,0xACBACBAD,0xBBCBBCBB,
+0xBCBBCBBC,0xCBBCBBCB,0xABCBCBBB,0xCBBACBAC,0xBACCBBBB,0x0028C8B0,0xBBBADBBB,0xBCBABADB,
+0xCBBBAACA,0xBABCBBBA,0x9BAAAACA,0x0890B9AB,0x53544321,0x43245343,0x43342443,0x24253343,
+0x53343343,0x25333432,0x24433343,0x43433343,0x33243242,0x24334334,0x002AFAD5,0x24234324,
+0x24243224,0x34332242,0x43242342,0x33343332,0x34333325,0x33433324,0x34333343,0x43333243,
+0x33333332,0x01130433,0xCDCA9B10,0xCBCCBCCB,0xBBCACADB,0xBCBCBCBC,0xBCBBCBCB,0x00253E69,
+0xBDBBBCBC,0xCBBCBCBB,0xBADBBBCB,0xCBBBCBAC,0xBBBCBCBB,0xBBCBCBBC,0xBCBACBCB,0xBBCBBCBB,
+0xBACACBBC,0xBCBBBCBB,0xCBBACBAC,0xACABCBBA,0xCBBBCBBB,0xBBABCBBA,0xABAB9CAC,0xBAAAACAB,
+0x0018B1A2,0x8199A0C8,0x53633218,0x35334252,0x33432543,0x34343434,0x33434343,0x43244334,
+0x33433433,0x33433244,0x33432434,0x34332424,0x43433343,0x33433433,0x34334343,0x33433433,
+0x43332424,0x00282901,0x34333433,0x33342343,0x24243343,0x42324332,0x32243322,0x23243323,
+0x01114123,0xE9C98901,0xCCBADAC9,0xCBCBACCA,0xBCADBBCB,0xBCBBCCBB,0xCBBADBCB,0xCBBCBCBB,
+0xACACBCBB,0xACACBACB,0x002A1790,0xBBCBACBB,0xCACBBADB,0xACBBCBBA,0xACACBBCB,0xBCBBCBBB,
+0xBBCBBCBB,0xCBBCBBBC,0xBCBBCBBB,0xBBACACBB,0xBAACABCA,0xCABBACBB,0xAACABBBA,0x89A8CA9B,
+0x4202890A,0x35433452,0x42424434,0x001FBB23,0x43253433,0x53343433,0x33433432,0x24243244,
+0x33324243,0x43433434,0x34333242,0x32424334,0x43433343,0x25333433,0x33242433,0x43324343,
+0x34334333,0x33433433,0x33343343,0x43343334,0x00233A2E,0x31422432,0x33433323,0x33232242,
+0x01304322,0xF90B9011,0xCCBCBAD9,0xBDBBAEBB,0xCBCBCBCB,0xCACACACB,0xBDBBCBBA,0xACCBBBCA,
+0xBCACBBCB,0xCBCBBCBB,0xBBCBBCBB,0xBCBBCBBC,0xCBBBCBCB,0x0028FE00,0xCABCBCBB,0xBCBBCBBB,
+0xBBCBBBCB,0xACBBCBBC,0xBBBAADBB,0xACBCBBBC,0xACBACBBB,0xBAADBBBB,0xBABBACBB,0xAABABACB,
+0x8999AA9C,0x54204080,0x32524523,0x35335334,0x33434343,0x32434325,0x0021CB89,0x33244334,
+0x43243244,0x34325333,0x24243433,0x35333343,0x43433433,0x34333432,0x24343334,0x33433343,
+0x43334334,0x33433433,0x33343343,0x24323424,0x53332433,0x34333322,0x42333433,0x001C3A4D,
+0x23222413,0x11222332,0xB9899294,0xBDACAC9F,0xBCBBCDBB,0xADABCACC,0xBACACCBB,0xADBBCBCB,
+0xBCBBADBB,0xBACCBBCB,0xBCBCBBBC,0xCACBADBB,0xBCBCBBBA,0xBBBCBCBB,0xCACBBCBC,0xCBBBCBBA,
+0x0026F2C5,0xBBCBBBAC,0xCBBBCBBC,0xBACBBCBB,0xBBBACBAC,0xCABBACAC,0xCABCBBBB,0xAB9DBBBA,
+0x9C99DABB,0x9A99B9A9,0x028A8A99,0x26322600,0x52432543,0x53343423,0x24343242,0x34343334,
+0x33434334,0x0021D934,0x43325334,0x43343243,0x33433433,0x34333434,0x34234334,0x32533343,
+0x33343343,0x34333434,0x43324324,0x34332432,0x33432342,0x33243433,0x34333343,0x34333433,
+0x33322432,0x22331242,0x0011318D,0x99210222,0xBBCAE9C9,0xADADBBCD,0xADBBCACB,0xBCBBCBCB,
+0xCBCBCBBC,0xCBCBBCBB,0xCBBCBCBB,0xCBCBBCBB,0xCBACCBBB,0xBBCABCBA,0xCBBCBBCB,0xCBACBCBB,
+0xBCBBCBBB,0xACACBBCB,0xBACABCBB,0x0021F118,0xCABCBBAC,0xCBBACBBA,0xCBBBACAB,0xCBBACBBB,
+0xBBACBBBB,0xCBBBBABC,0xAB9CABBA,0x899999B9,0x53633218,0x33424443,0x53433435,0x33533432,
+0x33434343,0x33433434,0x33433434,0x33433434,0x001CEC98,0x33324253,0x34333434,0x43343334,
+0x33343243,0x34334334,0x24243343,0x32434333,0x42343324,0x43332432,0x24334333,0x34333243,
+0x24332433,0x33332433,0x24333243,0x33233323,0x11030323,0x0000136A,0xAAFAAC0B,0xCCBCBCAC,
+0xBCBBCCBB,0xABCADBBC,0xBCBBCBBC,0xADBBCBBC,0xBBBCBACB,0xBBCBBCBC,0xBCBBCBBC,0xCBBCBBCB,
+0xCBACBACB,0xBACABCBA,0xCBBCBBAC,0xBCBBBACA,0xBBBCBBCB,0xBACACBBC,0x0013FF28,0xBBCBBACB,
+0xCBCBBBCB,0xACABCBBA,0xCBBACBBB,0xACBACBBB,0xBADBBBBB,0xABBCBBAB,0xCABAACBB,0xA9999C8A,
+0x11101999,0x33332312,0x33225214,0x32443335,0x43335334,0x34324343,0x33432533,0x0007FB38,
+0x53334343,0x34334333,0x34333533,0x43343343,0x33433433,0x53343334,0x34243332,0x33242432,
+0x33343343,0x23353334,0x33343234,0x43343334,0x32235333,0x32423225,0x32142243,0x11433124,
+0x00000090,0x33133333,0x12312223,0x11231123,0x21211112,0x10111111,0x11001111,0x01901190,
+0x99910019,0x90090091,0x09900990,0x0A190999,0x1A09091A,0x99991A1A,0x9FFFD3B9,0x88008808,
+0x08008800,
+};
@@ -0,0 +1,125 @@
+// Audio data converted from WAV file by wav2sketch
+
+#include <Arduino.h>
+#include "AudioSampleTomtom.h"
+
+// Converted from tomtom.wav, using 11025 Hz, IMA-ADPCM encoding
+PROGMEM const unsigned int AudioSampleTomtom[936] = {
+0x43001B3C,0x00000000,0xFF7FFFFF,0x8BD3A042,0x78B73180,0x9A1109C1,0x8001BC64,0x091318AB,
+0x8159C55B,0x990800AA,0x95891032,0xA89B6308,0x0843B410,0x4AF0810A,0x90239AAA,0xA2899129,
+0x39C41CF2,0x54322918,0x003CFD40,0x15431121,0xA30A1720,0x888FC32A,0x0B8B00C8,0x80C88A91,
+0x74A6201A,0x40243281,0x96188421,0x90280409,0xABBE98AA,0x8A8AAF99,0x09981AF9,0x329A158A,
+0x18047892,0x11509221,0xAA83C818,0x003730DA,0x3A8F0991,0xBAB9C9EB,0x0BDD0ABB,0x80E8AA90,
+0x0C9BA9B9,0x6037829C,0x00081408,0x09199620,0x79131813,0x393889B4,0x918049D4,0xA8100320,
+0xF3BDB821,0x308F8298,0xCA31ACA0,0x1B338205,0x0034FB8A,0x90177282,0x33A9322A,0x20217812,
+0x07A8C8A8,0x0A990ADA,0xBB9DB9C9,0x99AAD0AA,0x91BAA91A,0x731856AB,0xAA428410,0xB9430A12,
+0x72B00DB9,0xB5109201,0xB870AA59,0x448B9A30,0x02AAC2AA,0x0035E9B7,0x0808629C,0x299040A5,
+0x21141010,0xF0830212,0x16A81378,0x93438A88,0x20280041,0x3CA31035,0xC90AD881,0x09D9BACF,
+0x0ABC9AA9,0xC0A99CB8,0x9B8909BE,0x809FDBA1,0x9918E039,0x45310180,0x0037C82B,0x18522083,
+0x38035423,0x48841335,0x643330B0,0x12502102,0x80931E02,0x10114023,0x2A12CB06,0xACCAC102,
+0xAA9BF02B,0xADAB00AE,0x8DE81989,0x21A99908,0xB9028CB8,0x1A08E0CB,0x88BFD188,0x0037CC94,
+0x29AA28AB,0x52441088,0x53338110,0x23533207,0x22142441,0x031A1609,0x34890911,0x20BF0001,
+0x8C8180D8,0xC8040932,0x9DC9919E,0x089F0189,0xA81AC8B8,0xA09A18D1,0xBA992CCC,0x88C069C9,
+0x0035D903,0x24AA0981,0x21420817,0x00708309,0x22241339,0x00C21B13,0x00094722,0x23100934,
+0x8305090D,0x00091308,0x32A8A008,0x0942277D,0xA928CB85,0xBABBAB95,0xD98A9CCE,0x9988F038,
+0xEB8A889A,0x0035EA5B,0x110AB08A,0xAD0809FB,0x8121DA81,0x12980231,0x0A123879,0x314A94A4,
+0x8A2808C6,0x22112725,0x24304003,0x58221443,0x39009012,0x8A271AA3,0x9D988C89,0xB989AEC2,
+0xAEA98111,0x0ABBA08C,0x0028043F,0x58ED9BBA,0x9B9509A3,0xAFA1AC99,0x19801AB0,0x3ABBABA1,
+0x9B511729,0x9018B226,0x067921BB,0x30814121,0xA2812987,0x02986588,0x52830913,0x38442009,
+0x21824316,0x86832889,0x8DF19980,0x003119F3,0x9A9BE909,0xABBBC898,0xBDB9A99E,0xBBABC89B,
+0x119BB109,0xAC4488AF,0x280229A8,0x111BF322,0x8FA30303,0x550A0273,0x82143011,0x3001273A,
+0x32101225,0x91264201,0x28801540,0x27282203,0x002D1F8E,0x50218210,0x0C00D001,0x41904081,
+0x18133611,0xBDA8A9BC,0xBDA9BAEC,0xABA9B99E,0xAAFAABCC,0xAAAACBBB,0x9019B99A,0xDF9998A9,
+0x18AB8180,0x040A0AEA,0x05452309,0x2192220A,0x12011047,0x0028DD7E,0x32174234,0x32633432,
+0x32211134,0x22253522,0x18101641,0x03112011,0x80418352,0x3018D118,0xA1740118,0x8D9AEAAA,
+0x8CDBB9A8,0xBBABCADA,0xAEBACACB,0xCADBA9CA,0x8BA89AA9,0xA8BAACBA,0x0028D654,0x9BB910BD,
+0x909CC8C8,0x2511509C,0x43222982,0x80243310,0x25343748,0x42236321,0x63332023,0x25123212,
+0x32345112,0x31013512,0x40036333,0x00036212,0x82310804,0xCB28BD88,0xD9900ADC,0x00292303,
+0x09BA9DBB,0xAABBFCA8,0xBA9FB9BC,0xDBBA9B99,0xE9989ADB,0xACBA009A,0x9CB09A88,0x1429BD99,
+0x99331889,0xB8023247,0x03357238,0x74131338,0x24411013,0xA0143210,0x1125408D,0x39043102,
+0x00240762,0x38A01236,0x02478811,0x41428080,0xCCB12813,0xAFC881BC,0xEB98ACA8,0x89ABBB9A,
+0xCD9999F9,0xBBABBA99,0x0339D9AB,0x0AC89EB9,0x08992731,0x31510200,0x12100137,0x53349020,
+0x31167333,0x002BFFC7,0x52310211,0x53234224,0x10821022,0x43180902,0x91510015,0x10005522,
+0x0888A010,0xC35CD921,0x9AADBBC9,0xBB88BECA,0xABBCCACC,0xAACBBBCB,0xBCDADBBA,0xABACBAAC,
+0xABAAACBB,0x9AAA9AD9,0x0021DB3B,0x08B008A9,0x469CC122,0x14318823,0x33533447,0x32226322,
+0x34323534,0x22353433,0x44333234,0x23102113,0x53345320,0x08111433,0x44189022,0x43289AA1,
+0xBBDC1081,0xBCEBAEBA,0xACBCCCBC,0x002C124E,0xCABAB9AC,0xBBCBBCBB,0xCBABBBCC,0x8BCBA9AA,
+0xA9AAABC8,0xAA9BFB09,0x88ACA9BA,0xE9111099,0x32433748,0x43423343,0x43552231,0x23532443,
+0x23225323,0x42122434,0x01100011,0x34183301,0x001B1019,0x2340A825,0x43434080,0x29134243,
+0x99ACFA02,0xBBBFB8AC,0xCBA99CDB,0xDDBC99AB,0xBBBACBBA,0xABCA99AC,0x80ABBBAA,0x03319808,
+0x32AED9BA,0xB2300632,0xBCAABC29,0x31423732,0x21136414,0x001DF680,0x22114563,0x43633323,
+0x20025333,0x25332322,0x01014382,0x1BB82412,0xAA99CCD8,0x9003619A,0x9AABFB00,0xAB9AADA9,
+0xBCEBCEBB,0xBBA9ABDB,0xBBBBCDBC,0xBCABAAAC,0x99A99BAA,0x651BB919,0x001CF3B2,0x89C889A0,
+0x71235211,0x02531013,0x43480008,0x22452337,0x23422211,0x44323354,0x52334122,0x14212243,
+0x02301080,0xB0108910,0xB9888AEF,0x3544410B,0x210ABA13,0xFFA99910,0xEBCCBAAB,0x00250608,
+0xDBCABABA,0xAAACCAAB,0xCBAACB99,0xAA089BBB,0x320AAABB,0x99BA0225,0x21212477,0x99102112,
+0xDA32AAD9,0x43524620,0x53243532,0x35321012,0x32442233,0x12223334,0x22408011,0x9EFA0133,
+0x001D08E8,0x9DB9998B,0x888109A9,0x1458AC80,0x01272110,0xDAAAFA22,0xACBEBBAB,0xBBCBCCCC,
+0xCBBBAA9A,0xD999ACB9,0x099809AB,0x30432812,0x23523217,0x35210112,0x24435322,0x01A92213,
+0x32633560,0x001CFD32,0x31210125,0x24343346,0x24225322,0x80010014,0xB99A8990,0xC9AAD82A,
+0x808ACDBC,0x1019A808,0xBB9430A8,0xEC8AC01C,0xA9BBCBEC,0xABABAEFB,0xBCBABBAC,0xAAAACCCB,
+0x089A99AC,0x21810880,0x0011F6C4,0x33312536,0x88009000,0x12277338,0x42222090,0x45522225,
+0x36233343,0x24253433,0x32132322,0x20011224,0x00100154,0xBEB00209,0x99AADCCB,0x8189FB98,
+0x42122010,0x9AB98814,0xBABFE810,0x001504B8,0xBCBDED99,0xCCBCBABB,0xBAABBBBB,0x9A989DBB,
+0x22422120,0x3559A033,0x22888312,0x09AC8452,0x8DD13099,0x47312288,0x53543443,0x43343222,
+0x32324433,0x32433433,0x13221323,0xBFFBA800,0x001C068F,0x89ABCB9A,0x900099A9,0x29922419,
+0x88012147,0xBDDD8801,0xBDBBDB99,0xCBBBCDBC,0xCACBCBAB,0xAABCACAB,0xBBA99989,0x7319999A,
+0x43133423,0x80133245,0x99ADB998,0x309CB999,0x34732226,0x0016FBAE,0x43334434,0x33234334,
+0x35334343,0x11223224,0x02252232,0x099BCD90,0x9AA02221,0xAABCCCCA,0x61912110,0xB08AA992,
+0xDB999BFF,0xDBCBCCBB,0xBAAACBBC,0xBABCDBBB,0xBCCBAAAA,0x00999BAC,0x0012FA58,0x80100001,
+0xCFB02208,0x31114189,0x81333532,0x54550022,0x34433445,0x22244223,0x43534333,0x12343332,
+0x10124322,0x12212244,0x12440080,0x00143231,0x24357218,0xB9912432,0xCBDAABDC,0x001304DE,
+0xBCBDBCCA,0xCBCBCBBC,0xCCBA9ABA,0xAAABBAAB,0xBADBBA9B,0x21000089,0xEFB0BA22,0x8880899A,
+0x9CF93340,0x8BBA99A9,0x43564531,0x33235433,0x42343344,0x22224333,0x41232113,0x21111245,
+0x00100359,0x11111433,0x19901880,0x32436642,0x01014234,0x800440B8,0xDBECBC98,0xBBACBDBB,
+0xCBDBBCBD,0xABAABCBA,0xABCBBABB,0x9B8000AB,0xBCAABDBA,0x22450099,0xC9890143,0xCA8119BB,
+0x18809AEE,0x000AFB54,0x43453344,0x43334442,0x42353343,0x33223322,0x21333534,0x10011110,
+0x43373002,0x03342433,0x01122510,0x13345310,0xAAEFB088,0xBCDBB99A,0xCCBDBBBC,0xBACBCBBC,
+0xBBCBBABC,0xBBCBAAAB,0x0011FCFB,0x89ABDBCB,0xAA989881,0xDBB8BCAA,0x112199CC,0x35180998,
+0x52801446,0x34353443,0x42243244,0x43432232,0x11222443,0x12332011,0x34244210,0x32323325,
+0x22444244,0x33342221,0x9AA99013,0x000404E4,0xBCABCCDB,0xCCBBDBBF,0xBBCBCBCB,0xBBBCBBBC,
+0xCABAAAAC,0xA9BBBBAB,0xDBBAACA9,0xCCBAABCD,0x08899A9B,0xABCBBDB9,0x43234209,0x35444335,
+0x33434533,0x33243343,0x33324335,0x32432223,0x000E01A9,0x22444332,0x19900113,0x24444733,
+0x22233333,0x33313333,0xD0312134,0xDBEBCCBD,0xCBBCBCCB,0xBCBBBADB,0xACBBBBBC,0xAABAAAAC,
+0xCBCB999A,0xCA99AACB,0xA9A909AB,0xAABBEDBA,0x09899BDB,0x0005FBA3,0x44522230,0x44463353,
+0x34234333,0x33243344,0x34334233,0x23334343,0x22232323,0x45353631,0x21433232,0x21001111,
+0xEA98A803,0xBDBAACAC,0xBBCCDBDB,0xBCCBBDBB,0xBABACACC,0xAAAACBCB,0x0013FEA4,0xACBCBABB,
+0xAAACBBCB,0xBABA9AA9,0xABABDAAC,0x9AACBABB,0x43532738,0x43442424,0x43243433,0x23533232,
+0x43353334,0x32243243,0x12333343,0x44235322,0x33243434,0x13233432,0x90111022,0x0003046F,
+0xCBACBECA,0xBDBCEBBA,0xBABCBBDB,0xBACBBCBC,0xBACBBCBB,0xBDDBBAAB,0xBAACBBAB,0xABBAACAC,
+0xBBBBCBCB,0xA98AACBB,0x45308BBB,0x44432544,0x33243343,0x34333443,0x33243234,0x22243325,
+0x000F00B6,0x23244333,0x44343313,0x32421433,0x43343434,0x31223232,0xA8980111,0xCBDFB9BB,
+0xCCBBCBCC,0xBBCBBBBC,0xBBBBBCBC,0xCABBBCBC,0xBACBBBBA,0xBBCBCCBB,0xACDBAAAA,0x9888A9AC,
+0x89A99BC9,0x0003FC4D,0x36337309,0x33534343,0x43432424,0x22243343,0x22433433,0x23432443,
+0x43343333,0x22222533,0x24344423,0x32222222,0x10901243,0xCDBA1120,0xCBCBCDBC,0xBCBBCBCB,
+0xBCBCBCBB,0xBBCBBBAC,0x000FFFB1,0xABBBBCBC,0xBABCBCBC,0xBABBBBAC,0x08AACBBC,0xDA9A8A08,
+0x4323220A,0x43336345,0x43353343,0x33334334,0x33243433,0x34432424,0x53423233,0x33333433,
+0x43432244,0x23232432,0xA9802321,0x00010309,0xDBA999B8,0xBCBACBDC,0xCBBCBCBC,0xBCBCBBCB,
+0xBACBBBAC,0xCBBBCCBB,0xBCBDBBAA,0xCCBBBBCB,0xABCBBBBB,0xA9ADBABB,0x28899AB9,0x44353453,
+0x34433343,0x43333443,0x43332242,0x35333424,0x000F0026,0x33224332,0x32434324,0x53343233,
+0x23243343,0x11123324,0x21110100,0xCDBCACB9,0xCBCDCBAB,0xCBBCBBCB,0xABBBBBCB,0xBBCBCBBC,
+0xADBCBBBC,0xBACABCBB,0xBBBACCBA,0xBCBBB9AB,0xBA09AAAB,0x0000FD6B,0x3534299A,0x53244343,
+0x43335333,0x34434343,0x43242433,0x32224333,0x34334343,0x43324343,0x22423432,0x12332323,
+0xB9990A00,0xBADBB9C9,0xBCDBCBCB,0xBAAEBBCB,0xACBBCBCB,0xBCBCBCBB,0x000C002D,0xACBACBAC,
+0xCAACBACB,0xCBBBACBA,0xACBAABAA,0x089AABBB,0x24321211,0x53243244,0x23325334,0x34343334,
+0x34334343,0x35333433,0x34343533,0x43433343,0x43232243,0x12332343,0x02421222,0x0001023D,
+0xBDBCBA11,0xABCDBBBC,0xBCBBCBBC,0xABABCBDB,0xCBBCBBDB,0xBACBACBA,0xBCCBACBB,0xBACBCBCB,
+0xCBBBCBBB,0xBBABBABA,0x32989CBB,0x35333331,0x43342534,0x33433343,0x34324243,0x33243243,
+0x0006FFC3,0x43434353,0x34333332,0x23253334,0x23325324,0x43333224,0xA9102233,0xBCBADBBA,
+0xACCBCBBC,0xACBCBBAD,0xBCBACBCB,0xDBCBBBBB,0xCBABACAB,0xABACADBB,0xAACACBAB,0xDBBBBBBB,
+0x9AAB99AA,0x0000FE4C,0x99190000,0x34432431,0x32435334,0x43343343,0x34334343,0x34343433,
+0x23243324,0x33324234,0x43234334,0x24343333,0x91232223,0x9CABA909,0xDBAA8CBB,0xBBCBCCBA,
+0xBADBCBBC,0xCBBCABCB,0x00090042,0xBBBCBCBB,0xBCACBBAD,0xCBBCBBBB,0xABAABBAB,0x9ABBBAAC,
+0x1099990A,0x24324312,0x33432434,0x32424343,0x43433434,0x43334332,0x33344334,0x32424334,
+0x33234243,0x32423343,0x13124233,0x0000016B,0x9A999211,0xA9CBAB9A,0xDBABEBAC,0xCBBBCABB,
+0xBCBCBBCB,0xCBACBBAC,0xCBCBBACB,0xBBBCACBB,0xBABCBBCB,0x9AADBBBB,0x99AAAABA,0x22231019,
+0x24332253,0x43434343,0x34333533,0x32423243,0x0003FFC0,0x32343325,0x34334334,0x34333253,
+0x32243433,0x12523324,0x13123312,0xAA999911,0xBACAACBB,0xBCCBACBC,0xBBCCBBCB,0xBBBCBCBB,
+0xCBCBBABD,0xBBBBDBBB,0xCBBBACAC,0xBABCBBBA,0xA9BBA9AC,0x0000FEE8,0x100999A9,0x12231210,
+0x32433143,0x43332425,0x43324433,0x32443343,0x32432433,0x43243324,0x53232423,0x31253222,
+0x12104332,0x99901111,0xBBBBAA9B,0xCBB9CBBB,0xBCCBBCBA,0xACACABCA,0x00040045,0xCBACBACA,
+0xBACBBCBA,0xBBBCBBAC,0xBBBACBBC,0xAA99C9AC,0x09A999A9,0x23111109,0x14333331,0x14322251,
+0x43243142,0x43332532,0x22533433,0x32432533,0x22533324,0x43323523,0x22312423,0x000000D7,
+0x90110112,0xAAB9A999,0xC99CBB9B,0xAACACBAA,0xACABAADB,0xBCBAAADB,0xACAAAADA,0x00779BCA,
+0x80808080,0x09080808,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+};
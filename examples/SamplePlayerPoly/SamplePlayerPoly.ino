@@ -0,0 +1,91 @@
+// Play drum sounds with a single polyphonic sample player.
+//
+// AudioPlayMemoryPoly plays up to 16 sounds at once, each with its own
+// gain, pan and pitch, and mixes them itself.  Compared to the
+// SamplePlayer example, no mixers are needed, and only 1 or 2 audio
+// blocks are used, however many sounds are playing.
+//
+// The kick and tom sounds are stored as IMA-ADPCM (wav2sketch -adpcm),
+// which uses about a quarter of the memory of 16 bit data.
+//
+// Four pushbuttons need to be connected, from pins 0 to 3 to GND.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+#include <Bounce.h>
+
+// WAV files converted to code by wav2sketch
+#include "AudioSampleSnare.h"        // http://www.freesound.org/people/KEVOY/sounds/82583/
+#include "AudioSampleTomtom.h"       // http://www.freesound.org/people/zgump/sounds/86334/
+#include "AudioSampleKick.h"         // http://www.freesound.org/people/DWSD/sounds/171104/
+
+// GUItool: begin automatically generated code
+AudioPlayMemoryPoly      drums;          //xy=150,100
+AudioOutputI2S           headphones;     //xy=350,100
+AudioConnection          patchCord1(drums, 0, headphones, 0);
+AudioConnection          patchCord2(drums, 1, headphones, 1);
+AudioControlSGTL5000     audioShield;    //xy=350,180
+// GUItool: end automatically generated code
+
+Bounce button0 = Bounce(0, 5);
+Bounce button1 = Bounce(1, 5);  // 5 ms debounce time
+Bounce button2 = Bounce(2, 5);
+Bounce button3 = Bounce(3, 5);
+
+int tom = 0;
+
+void setup() {
+  pinMode(0, INPUT_PULLUP);
+  pinMode(1, INPUT_PULLUP);
+  pinMode(2, INPUT_PULLUP);
+  pinMode(3, INPUT_PULLUP);
+
+  // 2 blocks for the stereo mix, plus output buffering
+  AudioMemory(6);
+
+  audioShield.enable();
+  audioShield.volume(0.5);
+}
+
+void loop() {
+  button0.update();
+  button1.update();
+  button2.update();
+  button3.update();
+
+  // Each sound plays on a free voice.  Gain is reduced so
+  // several sounds can play at once without clipping.
+  if (button0.fallingEdge()) {
+    drums.play(AudioSampleKick, 0.5);
+  }
+  if (button1.fallingEdge()) {
+    drums.play(AudioSampleSnare, 0.4, 0.2);  // slightly right
+  }
+  if (button2.fallingEdge()) {
+    // toms at three pitches, panned left to right
+    const float pitch[3] = {1.25, 1.0, 0.8};
+    drums.play(AudioSampleTomtom, 0.4, -0.6 + tom * 0.6, pitch[tom]);
+    tom = (tom + 1) % 3;
+  }
+  if (button3.fallingEdge()) {
+    // a flam: two snares a few milliseconds apart
+    drums.play(AudioSampleSnare, 0.25, -0.3, 0.98);
+    delay(15);
+    drums.play(AudioSampleSnare, 0.4, 0.3);
+  }
+
+  // print how many sounds are playing, once per second
+  static elapsedMillis msec;
+  if (msec > 1000) {
+    msec = 0;
+    Serial.print("voices playing: ");
+    Serial.print(drums.voicesPlaying());
+    Serial.print(", blocks max: ");
+    Serial.println(AudioMemoryUsageMax());
+  }
+}
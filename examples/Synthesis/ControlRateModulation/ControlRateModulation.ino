@@ -0,0 +1,55 @@
+// Control rate modulation: an LFO sweeps a filter, an envelope
+// shapes the volume and a sample & hold picks random pitches,
+// all by directly changing settings once per audio block.  None
+// of the modulators use any audio memory.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+
+AudioSynthWaveform          osc1;
+AudioFilterStateVariable    filter1;
+AudioMixer4                 mixer1;
+AudioOutputI2S              i2s1;
+AudioControlSGTL5000        sgtl5000_1;
+
+AudioModulatorLFO           lfo1;
+AudioModulatorEnvelope      env1;
+AudioModulatorSampleHold    sh1;
+
+AudioConnection patchCord1(osc1, 0, filter1, 0);
+AudioConnection patchCord2(filter1, 0, mixer1, 0);
+AudioConnection patchCord3(mixer1, 0, i2s1, 0);
+AudioConnection patchCord4(mixer1, 0, i2s1, 1);
+
+void setup() {
+  AudioMemory(8);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  osc1.begin(0.5, 220, WAVEFORM_BANDLIMIT_SAWTOOTH);
+  filter1.resonance(2.0);
+
+  // filter frequency sweeps 3 octaves, centered at 800 Hz
+  lfo1.begin(WAVEFORM_TRIANGLE);
+  lfo1.frequency(0.3);
+  lfo1.modulate(filter1, MODULATE_FREQUENCY, 800, 1.5);
+
+  // mixer gain follows the envelope, 0 to 0.8
+  env1.attack(5);
+  env1.decay(200);
+  env1.sustain(0.4);
+  env1.release(400);
+  env1.modulate(mixer1, 0, 0.0, 0.8);
+
+  // a new random pitch, within 1 octave of 220 Hz, 4 times per second
+  sh1.frequency(4);
+  sh1.modulate(osc1, MODULATE_FREQUENCY, 220, 1.0);
+}
+
+void loop() {
+  env1.noteOn();
+  delay(200);
+  env1.noteOff();
+  delay(50);
+}
@@ -0,0 +1,148 @@
+// IdleVoices
+//
+// Measure the CPU time used by a 32 voice synth, with a filter on
+// every voice and a reverb on the mix, while playing and when idle.
+//
+// Objects without input transmit nothing, so idle voices cost very
+// little.  Objects with a tail, like the biquad filters and freeverb,
+// keep running after their input stops, but only until the tail has
+// decayed to silence.  Then they also stop, and isActive() returns
+// false.  Compare the "playing", "tail" and "idle" CPU usage shown in
+// the Arduino Serial Monitor.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+#define VOICES 32
+
+AudioSynthWaveform   waveform[VOICES];
+AudioEffectEnvelope  envelope[VOICES];
+AudioFilterBiquad    filter[VOICES];
+AudioMixer4          mixer[11];
+AudioEffectFreeverb  freeverb1;
+AudioMixer4          output;
+AudioOutputI2S       i2s1;
+AudioControlSGTL5000 sgtl5000_1;
+
+AudioConnection patchCord[] = {
+  {waveform[0], envelope[0]}, {envelope[0], filter[0]}, {filter[0], 0, mixer[0], 0}, {waveform[1], envelope[1]}, {envelope[1], filter[1]}, {filter[1], 0, mixer[0], 1},
+  {waveform[2], envelope[2]}, {envelope[2], filter[2]}, {filter[2], 0, mixer[0], 2}, {waveform[3], envelope[3]}, {envelope[3], filter[3]}, {filter[3], 0, mixer[0], 3},
+  {waveform[4], envelope[4]}, {envelope[4], filter[4]}, {filter[4], 0, mixer[1], 0}, {waveform[5], envelope[5]}, {envelope[5], filter[5]}, {filter[5], 0, mixer[1], 1},
+  {waveform[6], envelope[6]}, {envelope[6], filter[6]}, {filter[6], 0, mixer[1], 2}, {waveform[7], envelope[7]}, {envelope[7], filter[7]}, {filter[7], 0, mixer[1], 3},
+  {waveform[8], envelope[8]}, {envelope[8], filter[8]}, {filter[8], 0, mixer[2], 0}, {waveform[9], envelope[9]}, {envelope[9], filter[9]}, {filter[9], 0, mixer[2], 1},
+  {waveform[10], envelope[10]}, {envelope[10], filter[10]}, {filter[10], 0, mixer[2], 2}, {waveform[11], envelope[11]}, {envelope[11], filter[11]}, {filter[11], 0, mixer[2], 3},
+  {waveform[12], envelope[12]}, {envelope[12], filter[12]}, {filter[12], 0, mixer[3], 0}, {waveform[13], envelope[13]}, {envelope[13], filter[13]}, {filter[13], 0, mixer[3], 1},
+  {waveform[14], envelope[14]}, {envelope[14], filter[14]}, {filter[14], 0, mixer[3], 2}, {waveform[15], envelope[15]}, {envelope[15], filter[15]}, {filter[15], 0, mixer[3], 3},
+  {waveform[16], envelope[16]}, {envelope[16], filter[16]}, {filter[16], 0, mixer[4], 0}, {waveform[17], envelope[17]}, {envelope[17], filter[17]}, {filter[17], 0, mixer[4], 1},
+  {waveform[18], envelope[18]}, {envelope[18], filter[18]}, {filter[18], 0, mixer[4], 2}, {waveform[19], envelope[19]}, {envelope[19], filter[19]}, {filter[19], 0, mixer[4], 3},
+  {waveform[20], envelope[20]}, {envelope[20], filter[20]}, {filter[20], 0, mixer[5], 0}, {waveform[21], envelope[21]}, {envelope[21], filter[21]}, {filter[21], 0, mixer[5], 1},
+  {waveform[22], envelope[22]}, {envelope[22], filter[22]}, {filter[22], 0, mixer[5], 2}, {waveform[23], envelope[23]}, {envelope[23], filter[23]}, {filter[23], 0, mixer[5], 3},
+  {waveform[24], envelope[24]}, {envelope[24], filter[24]}, {filter[24], 0, mixer[6], 0}, {waveform[25], envelope[25]}, {envelope[25], filter[25]}, {filter[25], 0, mixer[6], 1},
+  {waveform[26], envelope[26]}, {envelope[26], filter[26]}, {filter[26], 0, mixer[6], 2}, {waveform[27], envelope[27]}, {envelope[27], filter[27]}, {filter[27], 0, mixer[6], 3},
+  {waveform[28], envelope[28]}, {envelope[28], filter[28]}, {filter[28], 0, mixer[7], 0}, {waveform[29], envelope[29]}, {envelope[29], filter[29]}, {filter[29], 0, mixer[7], 1},
+  {waveform[30], envelope[30]}, {envelope[30], filter[30]}, {filter[30], 0, mixer[7], 2}, {waveform[31], envelope[31]}, {envelope[31], filter[31]}, {filter[31], 0, mixer[7], 3},
+  {mixer[0], 0, mixer[8], 0},
+  {mixer[1], 0, mixer[8], 1},
+  {mixer[2], 0, mixer[8], 2},
+  {mixer[3], 0, mixer[8], 3},
+  {mixer[4], 0, mixer[9], 0},
+  {mixer[5], 0, mixer[9], 1},
+  {mixer[6], 0, mixer[9], 2},
+  {mixer[7], 0, mixer[9], 3},
+  {mixer[8], 0, mixer[10], 0},
+  {mixer[9], 0, mixer[10], 1},
+  {mixer[10], 0, freeverb1, 0},
+  {mixer[10], 0, output, 0},
+  {freeverb1, 0, output, 1},
+  {output, 0, i2s1, 0},
+  {output, 0, i2s1, 1}
+};
+
+const float chord[4] = {130.81, 164.81, 196.00, 246.94};
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(60);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+  for (int i=0; i < VOICES; i++) {
+    waveform[i].begin(0.0, chord[i % 4] * (1 + i / 4), WAVEFORM_SAWTOOTH);
+    envelope[i].attack(20);
+    envelope[i].release(400);
+    filter[i].setLowpass(0, 1500 + 100 * i, 2.0);
+  }
+  for (int i=0; i < 8; i++) {
+    for (int ch=0; ch < 4; ch++) mixer[i].gain(ch, 0.25);
+  }
+  for (int ch=0; ch < 4; ch++) {
+    mixer[8].gain(ch, 0.25);
+    mixer[9].gain(ch, 0.25);
+  }
+  mixer[10].gain(0, 0.5);
+  mixer[10].gain(1, 0.5);
+  output.gain(0, 0.5);
+  output.gain(1, 0.5);
+  freeverb1.roomsize(0.8);
+}
+
+elapsedMillis msec;
+int phase = 0;
+
+void loop() {
+  // play all voices for 2 seconds, then release them and
+  // keep printing while the tails decay and the synth is idle
+  if (phase == 0) {
+    for (int i=0; i < VOICES; i++) {
+      waveform[i].amplitude(0.3);
+      envelope[i].noteOn();
+    }
+    AudioProcessorUsageMaxReset();
+    msec = 0;
+    phase = 1;
+  } else if (phase == 1 && msec >= 2000) {
+    for (int i=0; i < VOICES; i++) envelope[i].noteOff();
+    msec = 0;
+    phase = 2;
+  } else if (phase == 2 && msec >= 8000) {
+    phase = 0;
+  }
+
+  // silence each waveform once its envelope has finished, so
+  // nothing at all is transmitted by idle voices
+  int active_voices = 0, active_filters = 0;
+  for (int i=0; i < VOICES; i++) {
+    if (envelope[i].isActive()) {
+      active_voices++;
+    } else if (phase == 2) {
+      waveform[i].amplitude(0.0);
+    }
+    if (filter[i].isActive()) active_filters++;
+  }
+
+  static elapsedMillis print_msec;
+  if (print_msec >= 250) {
+    print_msec = 0;
+    if (active_voices > 0 && phase == 1) {
+      Serial.print("playing: ");
+    } else if (active_voices > 0 || active_filters > 0 || freeverb1.isActive()) {
+      Serial.print("tail:    ");
+    } else {
+      Serial.print("idle:    ");
+    }
+    Serial.print("CPU=");
+    Serial.print(AudioProcessorUsage());
+    Serial.print("%  reverb=");
+    Serial.print(freeverb1.processorUsage());
+    Serial.print("%  voices=");
+    Serial.print(active_voices);
+    Serial.print("  filters=");
+    Serial.print(active_filters);
+    Serial.print("  reverb ");
+    Serial.println(freeverb1.isActive() ? "active" : "finished");
+  }
+}
@@ -0,0 +1,97 @@
+// Play a Standard MIDI File on 8 synth voices.
+//
+// The file SONG.MID is played from the SD card, if present.  Otherwise
+// a short song stored in flash is played.  All timing is done by the
+// audio library, so loop() is free to do anything, even delay().
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SD.h>
+#include <SPI.h>
+#include <SerialFlash.h>
+
+#include "song.h"
+
+// Each note begins on its exact sample, one audio block after the
+// player reads it, so the objects may be created in any order.
+AudioPlayMidi        midi;
+
+AudioSynthWaveform   osc0, osc1, osc2, osc3, osc4, osc5, osc6, osc7;
+AudioEffectEnvelope  env0, env1, env2, env3, env4, env5, env6, env7;
+AudioMixer4          mixer1;
+AudioMixer4          mixer2;
+AudioMixer4          mixer3;
+AudioOutputI2S       i2s1;
+AudioControlSGTL5000 sgtl5000_1;
+
+AudioConnection patchCord1(osc0, env0);
+AudioConnection patchCord2(osc1, env1);
+AudioConnection patchCord3(osc2, env2);
+AudioConnection patchCord4(osc3, env3);
+AudioConnection patchCord5(osc4, env4);
+AudioConnection patchCord6(osc5, env5);
+AudioConnection patchCord7(osc6, env6);
+AudioConnection patchCord8(osc7, env7);
+AudioConnection patchCord9(env0, 0, mixer1, 0);
+AudioConnection patchCord10(env1, 0, mixer1, 1);
+AudioConnection patchCord11(env2, 0, mixer1, 2);
+AudioConnection patchCord12(env3, 0, mixer1, 3);
+AudioConnection patchCord13(env4, 0, mixer2, 0);
+AudioConnection patchCord14(env5, 0, mixer2, 1);
+AudioConnection patchCord15(env6, 0, mixer2, 2);
+AudioConnection patchCord16(env7, 0, mixer2, 3);
+AudioConnection patchCord17(mixer1, 0, mixer3, 0);
+AudioConnection patchCord18(mixer2, 0, mixer3, 1);
+AudioConnection patchCord19(mixer3, 0, i2s1, 0);
+AudioConnection patchCord20(mixer3, 0, i2s1, 1);
+
+AudioSynthWaveform  *osc[8] = { &osc0, &osc1, &osc2, &osc3, &osc4, &osc5, &osc6, &osc7 };
+AudioEffectEnvelope *env[8] = { &env0, &env1, &env2, &env3, &env4, &env5, &env6, &env7 };
+
+// Use these with the Teensy Audio Shield
+#define SDCARD_CS_PIN    10
+#define SDCARD_MOSI_PIN  7   // Teensy 4 ignores this, uses pin 11
+#define SDCARD_SCK_PIN   14  // Teensy 4 ignores this, uses pin 13
+
+bool have_sd = false;
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(20);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+  for (int i=0; i < 4; i++) {
+    mixer1.gain(i, 0.25);
+    mixer2.gain(i, 0.25);
+  }
+  for (int i=0; i < 8; i++) {
+    osc[i]->begin(WAVEFORM_BANDLIMIT_SAWTOOTH);
+    env[i]->attack(5);
+    env[i]->hold(0);
+    env[i]->decay(200);
+    env[i]->sustain(0.5);
+    env[i]->release(150);
+    midi.addVoice(*osc[i], *env[i]);
+  }
+  SPI.setMOSI(SDCARD_MOSI_PIN);
+  SPI.setSCK(SDCARD_SCK_PIN);
+  have_sd = SD.begin(SDCARD_CS_PIN);
+}
+
+void loop() {
+  if (!midi.isPlaying()) {
+    delay(1000);
+    if (have_sd && midi.play("SONG.MID")) {
+      Serial.println("Playing SONG.MID");
+    } else {
+      Serial.println("Playing song from flash");
+      midi.play(song, sizeof(song));
+    }
+  }
+  // timing does not depend on loop(), so a slow loop is fine
+  Serial.print("Position: ");
+  Serial.println(midi.positionMillis());
+  delay(500);
+}
@@ -0,0 +1,39 @@
+// A short chord progression, as a Standard MIDI File (type 0, one track)
+
+const unsigned char song[553] = {
+  0x4D, 0x54, 0x68, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x4D, 0x54,
+  0x72, 0x6B, 0x00, 0x00, 0x02, 0x13, 0x00, 0xFF, 0x51, 0x03, 0x09, 0x27, 0xC0, 0x00, 0x90, 0x3C,
+  0x5A, 0x00, 0x90, 0x40, 0x5A, 0x00, 0x90, 0x43, 0x5A, 0x00, 0x90, 0x30, 0x64, 0x81, 0x5C, 0x80,
+  0x3C, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x43, 0x00, 0x00, 0x80, 0x30, 0x00, 0x14, 0x90,
+  0x48, 0x46, 0x32, 0x80, 0x48, 0x00, 0x0A, 0x90, 0x4C, 0x46, 0x32, 0x80, 0x4C, 0x00, 0x0A, 0x90,
+  0x4F, 0x46, 0x32, 0x80, 0x4F, 0x00, 0x0A, 0x90, 0x4C, 0x46, 0x32, 0x80, 0x4C, 0x00, 0x0A, 0x90,
+  0x39, 0x5A, 0x00, 0x90, 0x3C, 0x5A, 0x00, 0x90, 0x40, 0x5A, 0x00, 0x90, 0x2D, 0x64, 0x81, 0x5C,
+  0x80, 0x39, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x2D, 0x00, 0x14,
+  0x90, 0x45, 0x46, 0x32, 0x80, 0x45, 0x00, 0x0A, 0x90, 0x48, 0x46, 0x32, 0x80, 0x48, 0x00, 0x0A,
+  0x90, 0x4C, 0x46, 0x32, 0x80, 0x4C, 0x00, 0x0A, 0x90, 0x48, 0x46, 0x32, 0x80, 0x48, 0x00, 0x0A,
+  0x90, 0x35, 0x5A, 0x00, 0x90, 0x39, 0x5A, 0x00, 0x90, 0x3C, 0x5A, 0x00, 0x90, 0x29, 0x64, 0x81,
+  0x5C, 0x80, 0x35, 0x00, 0x00, 0x80, 0x39, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x80, 0x29, 0x00,
+  0x14, 0x90, 0x41, 0x46, 0x32, 0x80, 0x41, 0x00, 0x0A, 0x90, 0x45, 0x46, 0x32, 0x80, 0x45, 0x00,
+  0x0A, 0x90, 0x48, 0x46, 0x32, 0x80, 0x48, 0x00, 0x0A, 0x90, 0x45, 0x46, 0x32, 0x80, 0x45, 0x00,
+  0x0A, 0x90, 0x37, 0x5A, 0x00, 0x90, 0x3B, 0x5A, 0x00, 0x90, 0x3E, 0x5A, 0x00, 0x90, 0x2B, 0x64,
+  0x81, 0x5C, 0x80, 0x37, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x80, 0x2B,
+  0x00, 0x14, 0x90, 0x43, 0x46, 0x32, 0x80, 0x43, 0x00, 0x0A, 0x90, 0x47, 0x46, 0x32, 0x80, 0x47,
+  0x00, 0x0A, 0x90, 0x4A, 0x46, 0x32, 0x80, 0x4A, 0x00, 0x0A, 0x90, 0x47, 0x46, 0x32, 0x80, 0x47,
+  0x00, 0x0A, 0x90, 0x3C, 0x5A, 0x00, 0x90, 0x40, 0x5A, 0x00, 0x90, 0x43, 0x5A, 0x00, 0x90, 0x30,
+  0x64, 0x81, 0x5C, 0x80, 0x3C, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x43, 0x00, 0x00, 0x80,
+  0x30, 0x00, 0x14, 0x90, 0x48, 0x46, 0x32, 0x80, 0x48, 0x00, 0x0A, 0x90, 0x4C, 0x46, 0x32, 0x80,
+  0x4C, 0x00, 0x0A, 0x90, 0x4F, 0x46, 0x32, 0x80, 0x4F, 0x00, 0x0A, 0x90, 0x4C, 0x46, 0x32, 0x80,
+  0x4C, 0x00, 0x0A, 0x90, 0x39, 0x5A, 0x00, 0x90, 0x3C, 0x5A, 0x00, 0x90, 0x40, 0x5A, 0x00, 0x90,
+  0x2D, 0x64, 0x81, 0x5C, 0x80, 0x39, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+  0x80, 0x2D, 0x00, 0x14, 0x90, 0x45, 0x46, 0x32, 0x80, 0x45, 0x00, 0x0A, 0x90, 0x48, 0x46, 0x32,
+  0x80, 0x48, 0x00, 0x0A, 0x90, 0x4C, 0x46, 0x32, 0x80, 0x4C, 0x00, 0x0A, 0x90, 0x48, 0x46, 0x32,
+  0x80, 0x48, 0x00, 0x0A, 0x90, 0x35, 0x5A, 0x00, 0x90, 0x39, 0x5A, 0x00, 0x90, 0x3C, 0x5A, 0x00,
+  0x90, 0x29, 0x64, 0x81, 0x5C, 0x80, 0x35, 0x00, 0x00, 0x80, 0x39, 0x00, 0x00, 0x80, 0x3C, 0x00,
+  0x00, 0x80, 0x29, 0x00, 0x14, 0x90, 0x41, 0x46, 0x32, 0x80, 0x41, 0x00, 0x0A, 0x90, 0x45, 0x46,
+  0x32, 0x80, 0x45, 0x00, 0x0A, 0x90, 0x48, 0x46, 0x32, 0x80, 0x48, 0x00, 0x0A, 0x90, 0x45, 0x46,
+  0x32, 0x80, 0x45, 0x00, 0x0A, 0x90, 0x37, 0x5A, 0x00, 0x90, 0x3B, 0x5A, 0x00, 0x90, 0x3E, 0x5A,
+  0x00, 0x90, 0x2B, 0x64, 0x81, 0x5C, 0x80, 0x37, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x80, 0x3E,
+  0x00, 0x00, 0x80, 0x2B, 0x00, 0x14, 0x90, 0x43, 0x46, 0x32, 0x80, 0x43, 0x00, 0x0A, 0x90, 0x47,
+  0x46, 0x32, 0x80, 0x47, 0x00, 0x0A, 0x90, 0x4A, 0x46, 0x32, 0x80, 0x4A, 0x00, 0x0A, 0x90, 0x47,
+  0x46, 0x32, 0x80, 0x47, 0x00, 0x00, 0xFF, 0x2F, 0x00,
+};
@@ -0,0 +1,76 @@
+// Modulation matrix demo: two LFOs and an envelope routed to
+// ladder filter frequency, resonance and a second oscillator's
+// frequency modulation input, using a single AudioModMatrix
+// instead of separate mixer, multiply and DC objects.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+
+AudioSynthWaveform         lfo1;
+AudioSynthWaveform         lfo2;
+AudioSynthWaveformDc       gate1;
+AudioEffectEnvelope        env1;
+AudioModMatrix             matrix1;
+AudioSynthWaveform         osc1;
+AudioSynthWaveformModulated osc2;
+AudioMixer4                mixer1;
+AudioFilterLadder          filter1;
+AudioOutputI2S             i2s1;
+AudioControlSGTL5000       sgtl5000_1;
+
+AudioConnection patchCord1(lfo1, 0, matrix1, 0);
+AudioConnection patchCord2(lfo2, 0, matrix1, 1);
+AudioConnection patchCord3(gate1, 0, env1, 0);
+AudioConnection patchCord4(env1, 0, matrix1, 2);
+AudioConnection patchCord5(matrix1, 0, filter1, 1);
+AudioConnection patchCord6(matrix1, 1, filter1, 2);
+AudioConnection patchCord7(matrix1, 2, osc2, 0);
+AudioConnection patchCord8(osc1, 0, mixer1, 0);
+AudioConnection patchCord9(osc2, 0, mixer1, 1);
+AudioConnection patchCord10(mixer1, 0, filter1, 0);
+AudioConnection patchCord11(filter1, 0, i2s1, 0);
+AudioConnection patchCord12(filter1, 0, i2s1, 1);
+
+void setup() {
+  AudioMemory(20);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  osc1.begin(0.3, 110, WAVEFORM_BANDLIMIT_SAWTOOTH);
+  osc2.begin(0.3, 110.5, WAVEFORM_BANDLIMIT_SQUARE);
+  osc2.frequencyModulation(1);
+  lfo1.begin(1.0, 0.25, WAVEFORM_TRIANGLE);
+  lfo2.begin(1.0, 5.0, WAVEFORM_SINE);
+  gate1.amplitude(1.0);
+  env1.attack(200);
+  env1.decay(600);
+  env1.sustain(0.3);
+  env1.release(800);
+  filter1.frequency(600);
+  filter1.octaveControl(3);
+  filter1.resonance(0.2);
+
+  // LFOs and envelopes only change slowly
+  matrix1.controlRate(8);
+
+  matrix1.holdChanges();
+  matrix1.gain(0, 0, 0.4);   // lfo1 -> filter frequency
+  matrix1.gain(2, 0, 0.5);   // envelope -> filter frequency
+  matrix1.gain(0, 1, 0.3);   // lfo1 -> filter resonance
+  matrix1.offset(1, 0.4);
+  matrix1.gain(1, 2, 0.02);  // lfo2 -> osc2 vibrato
+  matrix1.applyChanges();    // all routing starts together
+}
+
+void loop() {
+  env1.noteOn();
+  delay(1500);
+  env1.noteOff();
+  delay(1500);
+  // change two routes at the same instant
+  matrix1.holdChanges();
+  matrix1.gain(0, 0, random(0, 100) / 100.0);
+  matrix1.gain(2, 0, random(0, 100) / 100.0);
+  matrix1.applyChanges();
+}
@@ -0,0 +1,85 @@
+// Sample accurate step sequencer.
+//
+// Normally noteOn() takes effect at the start of the next audio block,
+// so drum hits land up to 2.9 ms late, by a different amount each time.
+// Here every step is given an exact time, in samples, so the rhythm is
+// perfectly even.  loop() only needs to stay a few steps ahead.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SD.h>
+#include <SPI.h>
+#include <SerialFlash.h>
+
+AudioSynthWaveform   kick, bass;
+AudioSynthNoiseWhite noise;
+AudioEffectEnvelope  kickEnv, hatEnv, bassEnv;
+AudioMixer4          mixer1;
+AudioOutputI2S       i2s1;
+AudioControlSGTL5000 sgtl5000_1;
+
+AudioConnection patchCord1(kick, kickEnv);
+AudioConnection patchCord2(noise, hatEnv);
+AudioConnection patchCord3(bass, bassEnv);
+AudioConnection patchCord4(kickEnv, 0, mixer1, 0);
+AudioConnection patchCord5(hatEnv, 0, mixer1, 1);
+AudioConnection patchCord6(bassEnv, 0, mixer1, 2);
+AudioConnection patchCord7(mixer1, 0, i2s1, 0);
+AudioConnection patchCord8(mixer1, 0, i2s1, 1);
+
+const char *kickPattern = "x...x...x...x..x";
+const char *hatPattern  = "..x...x...x...xx";
+const float bassNotes[16] = {
+  55.0, 0, 55.0, 0, 65.41, 0, 55.0, 0,
+  73.42, 0, 55.0, 0, 65.41, 0, 49.0, 0 };
+
+const float bpm = 124.0;
+const uint32_t stepLength = AUDIO_SAMPLE_RATE_EXACT * 60.0 / bpm / 4.0;
+
+uint32_t nextStepTime;
+int step = 0;
+
+void setup() {
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+  kick.begin(0.9, 55.0, WAVEFORM_SINE);
+  noise.amplitude(0.3);
+  bass.begin(0.5, 55.0, WAVEFORM_BANDLIMIT_SAWTOOTH);
+  kickEnv.attack(0.5);
+  kickEnv.hold(20);
+  kickEnv.decay(120);
+  kickEnv.sustain(0);
+  hatEnv.attack(0.2);
+  hatEnv.hold(0);
+  hatEnv.decay(30);
+  hatEnv.sustain(0);
+  bassEnv.attack(2);
+  bassEnv.decay(80);
+  bassEnv.sustain(0.4);
+  bassEnv.release(40);
+  mixer1.gain(0, 0.6);
+  mixer1.gain(1, 0.3);
+  mixer1.gain(2, 0.4);
+  // start a little in the future, so the first step is exact
+  nextStepTime = AudioEventTime() + 4 * AUDIO_BLOCK_SAMPLES;
+}
+
+void loop() {
+  // queue each step about 6 audio blocks (17 ms) before it plays
+  while ((int32_t)(nextStepTime - AudioEventTime()) < 6 * AUDIO_BLOCK_SAMPLES) {
+    if (kickPattern[step] == 'x') kickEnv.noteOn(nextStepTime);
+    if (hatPattern[step] == 'x') hatEnv.noteOn(nextStepTime);
+    if (bassNotes[step] > 0) {
+      bass.frequency(bassNotes[step], nextStepTime);
+      bassEnv.noteOn(nextStepTime);
+      bassEnv.noteOff(nextStepTime + stepLength / 2);
+    }
+    // accent the first beat of every bar
+    mixer1.gain(0, step == 0 ? 0.9 : 0.6, nextStepTime);
+    nextStepTime += stepLength;
+    step = (step + 1) % 16;
+  }
+}
@@ -0,0 +1,90 @@
+// WAV file player with cue, seek and loop points
+//
+// A button on pin 0 starts the sound.  The file is cued ahead of time,
+// so it begins on the very next audio update, without waiting for the
+// SD card.  A section of the file then repeats seamlessly, until a
+// button on pin 1 releases the loop and lets the file play to its end.
+//
+// This example uses the audio shield:
+//   http://www.pjrc.com/store/teensy3_audio.html
+//
+// Data files to put on your SD card can be downloaded here:
+//   http://www.pjrc.com/teensy/td_libs_AudioDataFiles.html
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+#include <Bounce.h>
+
+AudioPlaySdWav           playWav1;
+AudioOutputI2S           audioOutput;
+AudioConnection          patchCord1(playWav1, 0, audioOutput, 0);
+AudioConnection          patchCord2(playWav1, 1, audioOutput, 1);
+AudioControlSGTL5000     sgtl5000_1;
+
+Bounce button0 = Bounce(0, 15);
+Bounce button1 = Bounce(1, 15);
+
+// Use these with the Teensy Audio Shield
+#define SDCARD_CS_PIN    10
+#define SDCARD_MOSI_PIN  7
+#define SDCARD_SCK_PIN   14
+
+// Use these with the Teensy 3.5 & 3.6 & 4.1 SD card
+//#define SDCARD_CS_PIN    BUILTIN_SDCARD
+//#define SDCARD_MOSI_PIN  11  // not actually used
+//#define SDCARD_SCK_PIN   13  // not actually used
+
+#define FILENAME  "SDTEST2.WAV"  // filenames are always uppercase 8.3 format
+
+// loop points, in samples: about 2 to 3 seconds into the file
+#define LOOP_START   88200
+#define LOOP_END     132300
+
+void setup() {
+  Serial.begin(9600);
+  pinMode(0, INPUT_PULLUP);
+  pinMode(1, INPUT_PULLUP);
+  AudioMemory(8);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  SPI.setMOSI(SDCARD_MOSI_PIN);
+  SPI.setSCK(SDCARD_SCK_PIN);
+  if (!(SD.begin(SDCARD_CS_PIN))) {
+    // stop here, but print a message repetitively
+    while (1) {
+      Serial.println("Unable to access the SD card");
+      delay(500);
+    }
+  }
+  // parse the header and read the first audio ahead of time
+  if (!playWav1.cue(FILENAME)) {
+    Serial.println("Unable to cue " FILENAME);
+  }
+}
+
+void loop() {
+  button0.update();
+  button1.update();
+
+  if (button0.fallingEdge()) {
+    // start instantly, looping from LOOP_END back to LOOP_START
+    playWav1.setLoop(LOOP_START, LOOP_END);
+    playWav1.play();
+    Serial.println("Play, looping");
+  }
+  if (button1.fallingEdge()) {
+    playWav1.clearLoop();
+    Serial.println("Loop released");
+  }
+  if (playWav1.isStopped()) {
+    // cue the file again, ready for the next button press
+    playWav1.cue(FILENAME);
+    Serial.println("Cued");
+  }
+}
@@ -19,7 +19,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
-// compile with:  gcc -O2 -Wall -o wav2sketch wav2sketch.c
+// compile with:  gcc -O2 -Wall -o wav2sketch wav2sketch.c -lm
 //                i686-w64-mingw32-gcc -s -O2 -Wall wav2sketch.c -o wav2sketch.exe
 
 #include <stdio.h>
@@ -28,17 +28,48 @@
 #include <stdarg.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <dirent.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#endif
+
+struct wav_info {
+	char *filename;
+	char samplename[64];
+	uint16_t format;	// 1 = integer PCM, 3 = floating point
+	uint16_t channels;
+	uint16_t bits;
+	uint32_t rate;
+	uint32_t offset;	// file position of the audio data
+	uint32_t bytes;		// size of the audio data
+	uint64_t hash;		// format and audio data, to find duplicates
+	int duplicate;		// index of an identical earlier file, or -1
+};
 
 uint8_t ulaw_encode(int16_t audio);
+int16_t ulaw_decode(uint8_t code);
+uint8_t adpcm_encode(int16_t audio);
+void adpcm_encode_block(FILE *out, const int16_t *audio);
+void read_header(FILE *in, struct wav_info *w);
+double * read_audio(FILE *in, const struct wav_info *w, uint32_t *length);
+double sample_value(const uint8_t *p, int format, int bits);
+double * resample(const double *in, uint32_t inlen, uint32_t inrate, uint32_t outrate, uint32_t *outlen);
+uint32_t output_rate(uint32_t rate);
+void trim(const double *audio, uint32_t *start, uint32_t *length);
+void quality(int16_t original, int16_t decoded);
 void print_byte(FILE *out, uint8_t b);
 void filename2samplename(void);
 uint32_t padding(uint32_t length, uint32_t block);
+void skip(FILE *in, uint32_t count);
 uint8_t read_uint8(FILE *in);
 int16_t read_int16(FILE *in);
 uint32_t read_uint32(FILE *in);
+void report(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
 void die(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
 
 // WAV file format:
@@ -47,80 +78,284 @@ void die(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
 const char *filename="";
 char samplename[64];
 unsigned int bcount, wcount;
-unsigned int total_length=0;
 int pcm_mode=0;
-
-void wav2c(FILE *in, FILE *out, FILE *outh)
+int adpcm_mode=0;
+int trim_mode=0;
+uint32_t target_rate=0;
+int jobs=1;
+int32_t adpcm_predict, adpcm_index;
+double signal_energy, error_energy;
+char report_text[1024];
+
+// IMA-ADPCM tables, the same as data_adpcm.c in the library
+const int16_t adpcm_step_table[89] = {
+     7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+   130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+   337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+   876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+  2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+  5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+ 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+const int8_t adpcm_index_table[16] = {
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// parse the WAV header, leaving the file at the start of the audio data
+void read_header(FILE *in, struct wav_info *w)
 {
-	uint32_t header[4];
-	int16_t format, channels, bits;
-	uint32_t rate;
-	uint32_t i, length, padlength=0, arraylen;
-	uint32_t chunkSize;
-	int32_t audio=0;
+	uint32_t header[3];
+	uint32_t i, id, chunkSize;
 
-	// read the WAV file's header
-	for (i=0; i < 4; i++) {
+	for (i=0; i < 3; i++) {
 		header[i] = read_uint32(in);
 	}
-	while (header[3] != 0x20746D66) {
+	if (header[0] != 0x46464952 || header[2] != 0x45564157)
+		die("file %s is not a WAV file", filename);
+	while (1) {
 		// skip past unknown sections until "fmt "
+		id = read_uint32(in);
 		chunkSize = read_uint32(in);
-		for (i=0; i < chunkSize; i++) {
-			read_uint8(in);
-		}
-		header[3] = read_uint32(in);
+		if (id == 0x20746D66) break;
+		skip(in, chunkSize + (chunkSize & 1));
 	}
-	chunkSize = read_uint32(in);
+	if (chunkSize < 16) die("file %s has a bad format header", filename);
 
 	// read the audio format parameters
-	format = read_int16(in);
-	channels = read_int16(in);
-	rate = read_uint32(in);
+	w->format = read_int16(in);
+	w->channels = read_int16(in);
+	w->rate = read_uint32(in);
 	read_uint32(in); // ignore byterate
 	read_int16(in);  // ignore blockalign
-	bits = read_int16(in);
-	//printf("format: %d, channels: %d, rate: %d, bits %d\n", format, channels, rate, bits);
-	if (format != 1)
+	w->bits = read_int16(in);
+	chunkSize -= 16;
+	if (w->format == 0xFFFE && chunkSize >= 24) {
+		// WAVE_FORMAT_EXTENSIBLE, the real format begins the GUID
+		skip(in, 8);
+		w->format = read_int16(in);
+		skip(in, 14);
+		chunkSize -= 24;
+	}
+	//printf("format: %d, channels: %d, rate: %d, bits %d\n", w->format, w->channels, w->rate, w->bits);
+	if (w->format == 1) {
+		if (w->bits != 8 && w->bits != 16 && w->bits != 24 && w->bits != 32)
+			die("file %s has %d bit format, but only 8, 16, 24 & 32 are supported",
+			  filename, w->bits);
+	} else if (w->format == 3) {
+		if (w->bits != 32 && w->bits != 64)
+			die("file %s has %d bit floating point, only 32 & 64 are supported",
+			  filename, w->bits);
+	} else {
 		die("file %s is compressed, only uncompressed supported", filename);
-	if (rate != 44100 && rate != 22050 && rate != 11025 /*&& rate != 8000*/ )
-		die("sample rate %d in %s is unsupported\n"
-		  "Only 44100, 22050, 11025 work", rate, filename);
-	if (channels != 1 && channels != 2)
-		die("file %s has %d channels, but only 1 & 2 are supported", filename, channels);
-	if (bits != 16)
-		die("file %s has %d bit format, but only 16 is supported", filename, bits);
+	}
+	if (w->rate < 1000 || w->rate > 768000)
+		die("sample rate %d in %s is unsupported", w->rate, filename);
+	if (w->channels < 1)
+		die("file %s has no channels", filename);
 
 	// skip past any extra data on the WAVE header (hopefully it doesn't matter?)
-	for (chunkSize -= 16; chunkSize > 0; chunkSize--) {
-		read_uint8(in);
-	}
+	skip(in, chunkSize + (chunkSize & 1));
 
 	// read the data header, skip non-audio data
 	while (1) {
-		header[0] = read_uint32(in);
-		length = read_uint32(in);
-		if (header[0] == 0x61746164) break; // beginning of actual audio data
+		id = read_uint32(in);
+		chunkSize = read_uint32(in);
+		if (id == 0x61746164) break; // beginning of actual audio data
 		// skip over non-audio data
-		for (i=0; i < length; i++) {
-			read_uint8(in);
-		}
+		skip(in, chunkSize + (chunkSize & 1));
 	}
+	w->offset = ftell(in);
+	w->bytes = chunkSize;
 
 	// the length must be a multiple of the data size
-	if (channels == 2) {
-		if (length % 4) die("file %s data length is not a multiple of 4", filename);
-		length = length / 4;
+	if (w->bytes % (w->channels * w->bits / 8))
+		die("file %s data length is not a multiple of %d", filename,
+		  w->channels * w->bits / 8);
+}
+
+// read all the audio, mixing any number of channels to mono, scaled
+// so 16 bit samples have their usual values
+double * read_audio(FILE *in, const struct wav_info *w, uint32_t *length)
+{
+	uint32_t i, c, frame, size = w->bits / 8;
+	const uint8_t *p;
+	uint8_t *data;
+	double *audio, sum;
+
+	frame = w->channels * size;
+	*length = w->bytes / frame;
+	data = malloc(w->bytes + 1);
+	audio = malloc(*length * sizeof(double) + 1);
+	if (!data || !audio) die("out of memory reading %s", filename);
+	if (fread(data, 1, w->bytes, in) != w->bytes)
+		die("error, end of data while reading from %s\n", filename);
+	p = data;
+	for (i=0; i < *length; i++) {
+		if (w->format == 1 && w->bits == 16) {
+			// integer math, so 16 bit files convert exactly as
+			// they always have, stereo averaged with truncation
+			int32_t isum = 0;
+			for (c=0; c < w->channels; c++) {
+				isum += (int16_t)(p[0] | (p[1] << 8));
+				p += 2;
+			}
+			audio[i] = isum / (int32_t)w->channels;
+		} else {
+			sum = 0;
+			for (c=0; c < w->channels; c++) {
+				sum += sample_value(p, w->format, w->bits);
+				p += size;
+			}
+			audio[i] = sum / w->channels;
+		}
+	}
+	free(data);
+	return audio;
+}
+
+double sample_value(const uint8_t *p, int format, int bits)
+{
+	uint32_t n;
+
+	if (format == 3) {
+		if (bits == 32) {
+			float f;
+			n = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+			memcpy(&f, &n, 4);
+			return f * 32768.0;
+		} else {
+			double d;
+			uint64_t n64 = 0;
+			int i;
+			for (i=7; i >= 0; i--) n64 = (n64 << 8) | p[i];
+			memcpy(&d, &n64, 8);
+			return d * 32768.0;
+		}
+	}
+	switch (bits) {
+	case 8:
+		return ((int)p[0] - 128) * 256.0;
+	case 16:
+		return (int16_t)(p[0] | (p[1] << 8));
+	case 24:
+		n = (p[0] << 8) | (p[1] << 16) | ((uint32_t)p[2] << 24);
+		return (int32_t)n / 65536.0;
+	default:
+		n = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+		return (int32_t)n / 65536.0;
+	}
+}
+
+// the library plays 44100, 22050 and 11025 Hz.  Other rates are
+// converted to the lowest of these which doesn't lose bandwidth.
+uint32_t output_rate(uint32_t rate)
+{
+	if (target_rate) return target_rate;
+	if (rate <= 11025) return 11025;
+	if (rate <= 22050) return 22050;
+	return 44100;
+}
+
+// modified Bessel function of the first kind, for the Kaiser window
+static double bessel_i0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	int k;
+
+	for (k=1; k < 50; k++) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+		if (term < sum * 1e-12) break;
+	}
+	return sum;
+}
+
+// Windowed sinc sample rate conversion, for any ratio.  The Kaiser
+// window (beta 8, 16 zero crossings each side) keeps aliases and images
+// about 80 dB down, with the passband ending at 90% of the lower of the
+// two Nyquist frequencies.  The kernel is tabulated and linearly
+// interpolated, and the weights normalized so DC passes exactly.
+double * resample(const double *in, uint32_t inlen, uint32_t inrate, uint32_t outrate, uint32_t *outlen)
+{
+	const int crossings = 16;
+	const int resolution = 256;	// table points per input sample
+	const double beta = 8.0;
+	double step = (double)inrate / (double)outrate;
+	double fc = (step > 1.0) ? 0.9 / step : 0.9;
+	double width = crossings / fc;
+	double *table, *out, x, t, sum, weight, h, frac;
+	uint32_t j, size;
+	int32_t k, first, last;
+
+	size = (uint32_t)(width * resolution) + 2;
+	table = malloc(size * sizeof(double));
+	if (!table) die("out of memory resampling %s", filename);
+	for (j=0; j < size; j++) {
+		x = (double)j / resolution;
+		if (x >= width) {
+			table[j] = 0;
+			continue;
+		}
+		h = (j == 0) ? fc : sin(M_PI * fc * x) / (M_PI * x);
+		table[j] = h * bessel_i0(beta * sqrt(1.0 - (x / width) * (x / width)))
+		  / bessel_i0(beta);
 	}
-	if (channels == 1) {
-		if (length % 1) die("file %s data length is not a multiple of 2", filename);
-		length = length / 2;
+	*outlen = (uint32_t)((double)inlen / step);
+	out = malloc(*outlen * sizeof(double) + 1);
+	if (!out) die("out of memory resampling %s", filename);
+	for (j=0; j < *outlen; j++) {
+		t = j * step;
+		first = (int32_t)ceil(t - width);
+		last = (int32_t)floor(t + width);
+		if (first < 0) first = 0;
+		if (last >= (int32_t)inlen) last = inlen - 1;
+		sum = 0;
+		weight = 0;
+		for (k=first; k <= last; k++) {
+			x = fabs(t - k) * resolution;
+			frac = x - floor(x);
+			h = table[(uint32_t)x] + (table[(uint32_t)x + 1] - table[(uint32_t)x]) * frac;
+			sum += in[k] * h;
+			weight += h;
+		}
+		out[j] = (weight > 0) ? sum / weight : 0;
 	}
+	free(table);
+	return out;
+}
+
+// find the audio between leading and trailing silence, anything
+// quieter than -60 dB
+void trim(const double *audio, uint32_t *start, uint32_t *length)
+{
+	const double threshold = 32768.0 / 1000.0;
+	uint32_t begin = 0, end = *length;
+
+	while (begin < end && fabs(audio[begin]) < threshold) begin++;
+	while (end > begin && fabs(audio[end - 1]) < threshold) end--;
+	*start = begin;
+	*length = end - begin;
+}
+
+uint32_t wav2c(const int16_t *audio, uint32_t length, uint32_t rate, FILE *out, FILE *outh)
+{
+	int16_t format=0;
+	uint32_t i, padlength=0, arraylen;
+	int32_t sample;
+	int16_t block[128];
+
 	if (length > 0xFFFFFF) die("file %s data length is too long", filename);
 	bcount = 0;
 
 	// AudioPlayMemory requires padding to 2.9 ms boundary (128 samples @ 44100)
-	if (rate == 44100) {
+	// and ADPCM is stored in blocks of 128 samples at any rate
+	if (adpcm_mode) {
+		padlength = padding(length, 128);
+		format = (rate == 44100) ? 1 : ((rate == 22050) ? 2 : 3);
+	} else if (rate == 44100) {
 		padlength = padding(length, 128);
 		format = 1;
 	} else if (rate == 22050) {
@@ -130,36 +365,53 @@ void wav2c(FILE *in, FILE *out, FILE *outh)
 		padlength = padding(length, 32);
 		format = 3;
 	}
-	if (pcm_mode) {
+	if (adpcm_mode) {
+		// each block is a header word plus 16 words of 4 bit codes
+		arraylen = (length + padlength) / 128 * 17 + 1;
+		format |= 0x40;
+	} else if (pcm_mode) {
 		arraylen = ((length + padlength) * 2 + 3) / 4 + 1;
 		format |= 0x80;
 	} else {
 		arraylen = (length + padlength + 3) / 4 + 1;
 	}
-	total_length += arraylen;
 
 	// output a minimal header, just the length, #bits and sample rate
 	fprintf(outh, "extern const unsigned int AudioSample%s[%d];\n", samplename, arraylen);	
 	fprintf(out, "// Converted from %s, using %d Hz, %s encoding\n", filename, rate,
-	  (pcm_mode ? "16 bit PCM" : "u-law"));
+	  (adpcm_mode ? "IMA-ADPCM" : (pcm_mode ? "16 bit PCM" : "u-law")));
 	fprintf(out, "PROGMEM const unsigned int AudioSample%s[%d] = {\n", samplename, arraylen);
 	fprintf(out, "0x%08X,", length | (format << 24));
 	wcount = 1;
-
-	// finally, read the audio data
-	while (length > 0) {
-		if (channels == 1) {
-			audio = read_int16(in);
-		} else {
-			audio = read_int16(in);
-			audio += read_int16(in);
-			audio /= 2;
+	signal_energy = 0;
+	error_energy = 0;
+
+	// finally, encode the audio data
+	if (adpcm_mode) {
+		adpcm_predict = 0;
+		adpcm_index = 0;
+		while (length > 0) {
+			for (i=0; i < 128; i++) {
+				if (length > 0) {
+					block[i] = *audio++;
+					length--;
+				} else {
+					block[i] = 0;
+				}
+			}
+			adpcm_encode_block(out, block);
 		}
+		padlength = 0;
+	}
+	while (length > 0) {
+		sample = *audio++;
 		if (pcm_mode) {
-			print_byte(out, audio);
-			print_byte(out, audio >> 8);
+			print_byte(out, sample);
+			print_byte(out, sample >> 8);
 		} else {
-			print_byte(out, ulaw_encode(audio));
+			uint8_t code = ulaw_encode(sample);
+			quality(sample, ulaw_decode(code));
+			print_byte(out, code);
 		}
 		length--;
 	}
@@ -172,6 +424,72 @@ void wav2c(FILE *in, FILE *out, FILE *outh)
 	}
 	if (wcount > 0) fprintf(out, "\n");
 	fprintf(out, "};\n");
+	if (!pcm_mode && signal_energy > 0) {
+		// signal to noise ratio, to compare encodings
+		report("    SNR %.1f dB\n", (error_energy > 0) ?
+		  10.0 * log10(signal_energy / error_energy) : 99.9);
+	}
+	return arraylen;
+}
+
+void quality(int16_t original, int16_t decoded)
+{
+	double err = (double)original - (double)decoded;
+
+	signal_energy += (double)original * (double)original;
+	error_energy += err * err;
+}
+
+// encode 128 samples, as one header word (the decoder state at the
+// start of the block) and 64 bytes of 4 bit codes, first sample in
+// the low bits.  The state in each block allows playback to begin
+// at any block.
+void adpcm_encode_block(FILE *out, const int16_t *audio)
+{
+	uint8_t code1, code2;
+	int i;
+
+	print_byte(out, adpcm_predict);
+	print_byte(out, adpcm_predict >> 8);
+	print_byte(out, adpcm_index);
+	print_byte(out, 0);
+	for (i=0; i < 128; i += 2) {
+		code1 = adpcm_encode(audio[i]);
+		code2 = adpcm_encode(audio[i + 1]);
+		print_byte(out, code1 | (code2 << 4));
+	}
+}
+
+// IMA-ADPCM encode, choosing the code which decodes closest to
+// the original, and updating the state exactly as the decoder will
+uint8_t adpcm_encode(int16_t audio)
+{
+	int32_t step, diff, predict, best_predict=0, err, best_err=0x7FFFFFFF;
+	uint8_t code, best=0;
+
+	step = adpcm_step_table[adpcm_index];
+	for (code=0; code < 16; code++) {
+		diff = step >> 3;
+		if (code & 4) diff += step;
+		if (code & 2) diff += step >> 1;
+		if (code & 1) diff += step >> 2;
+		if (code & 8) diff = -diff;
+		predict = adpcm_predict + diff;
+		if (predict > 32767) predict = 32767;
+		if (predict < -32768) predict = -32768;
+		err = abs(audio - predict);
+		if (err < best_err) {
+			best_err = err;
+			best_predict = predict;
+			best = code;
+		}
+	}
+	quality(audio, best_predict);
+	adpcm_predict = best_predict;
+	adpcm_index += adpcm_index_table[best];
+	if (adpcm_index < 0) adpcm_index = 0;
+	if (adpcm_index > 88) adpcm_index = 88;
+	return best;
 }
 
 
@@ -200,6 +518,20 @@ uint8_t ulaw_encode(int16_t audio)
 }
 
 
+int16_t ulaw_decode(uint8_t code)
+{
+	int32_t r, n;
+
+	// same as ulaw_decode_table in data_ulaw.c
+	r = (code >> 4) & 7;
+	n = (code & 0x0F) << (r + 3);
+	n |= 1 << (r + 7);
+	n |= 1 << (r + 2);
+	n -= 128;
+	if (code & 0x80) n = -n;
+	return n;
+}
+
 
 // compute the extra padding needed
 uint32_t padding(uint32_t length, uint32_t block)
@@ -233,12 +565,16 @@ void print_byte(FILE *out, uint8_t b)
 void filename2samplename(void)
 {
 	int len, i, n;
+	const char *name = filename, *p;
 	char c;
 
-	len = strlen(filename) - 4;
+	for (p = filename; *p; p++) {
+		if (*p == '/' || *p == '\\') name = p + 1;
+	}
+	len = strlen(name) - 4;
 	if (len >= sizeof(samplename)-1) len = sizeof(samplename)-1;
 	for (i=0, n=0; n < len; i++) {
-		c = filename[i];
+		c = name[i];
 		if (isalpha(c) || c == '_' || (isdigit(c) && n > 0)) {
 			samplename[n] = (n == 0) ? toupper(c) : tolower(c);
 			n++;
@@ -247,58 +583,351 @@ void filename2samplename(void)
 	samplename[n] = 0;
 }
 
+// 64 bit FNV-1a, of the format and all audio data
+uint64_t hash_audio(FILE *in, const struct wav_info *w)
+{
+	uint64_t hash = 0xCBF29CE484222325ull;
+	uint8_t buf[4096];
+	uint32_t i, n, remain = w->bytes;
+	uint32_t fmt[4] = { w->format, w->channels, w->bits, w->rate };
 
-const char *title = "// Audio data converted from WAV file by wav2sketch\n\n";
+	for (i=0; i < sizeof(fmt); i++) {
+		hash = (hash ^ ((uint8_t *)fmt)[i]) * 0x100000001B3ull;
+	}
+	while (remain > 0) {
+		n = (remain < sizeof(buf)) ? remain : sizeof(buf);
+		if (fread(buf, 1, n, in) != n) die("error, end of data while reading from %s\n", filename);
+		for (i=0; i < n; i++) {
+			hash = (hash ^ buf[i]) * 0x100000001B3ull;
+		}
+		remain -= n;
+	}
+	return hash;
+}
 
-int main(int argc, char **argv)
+// compare the audio data of two files with the same hash
+int same_audio(const struct wav_info *a, const struct wav_info *b)
+{
+	FILE *fa, *fb;
+	uint8_t bufa[4096], bufb[4096];
+	uint32_t n, remain = a->bytes;
+	int same = 1;
+
+	if (a->format != b->format || a->channels != b->channels || a->bits != b->bits
+	  || a->rate != b->rate || a->bytes != b->bytes) return 0;
+	fa = fopen(a->filename, "rb");
+	fb = fopen(b->filename, "rb");
+	if (!fa || !fb) die("unable to read file %s", fa ? b->filename : a->filename);
+	fseek(fa, a->offset, SEEK_SET);
+	fseek(fb, b->offset, SEEK_SET);
+	while (remain > 0 && same) {
+		n = (remain < sizeof(bufa)) ? remain : sizeof(bufa);
+		if (fread(bufa, 1, n, fa) != n || fread(bufb, 1, n, fb) != n) same = 0;
+		else if (memcmp(bufa, bufb, n) != 0) same = 0;
+		remain -= n;
+	}
+	fclose(fa);
+	fclose(fb);
+	return same;
+}
+
+struct wav_info *list=NULL;
+int list_count=0, list_size=0;
+
+void add_file(const char *name)
+{
+	int len = strlen(name);
+
+	if (len < 5) return;
+	if (strcasecmp(name + len - 4, ".wav") != 0) return;
+	if (list_count >= list_size) {
+		list_size = list_size ? list_size * 2 : 256;
+		list = realloc(list, list_size * sizeof(struct wav_info));
+		if (!list) die("out of memory");
+	}
+	memset(&list[list_count], 0, sizeof(struct wav_info));
+	list[list_count].filename = strdup(name);
+	list[list_count].duplicate = -1;
+	list_count++;
+}
+
+// add all WAV files in a directory, or a single file
+void add_path(const char *path)
 {
 	DIR *dir;
 	struct dirent *f;
 	struct stat s;
-	FILE *fp, *outc=NULL, *outh=NULL;
-	char buf[128];
-	int i, len;
+	char name[1024];
 
-	// By default, audio is u-law encoded to reduce the memory requirement
-	// in half.  However, u-law does add distortion.  If "-16" is specified
-	// on the command line, the original 16 bit PCM samples are used.
-	for (i=1; i < argc; i++) {
-		if (strcmp(argv[i], "-16") == 0) pcm_mode = 1;
+	if (stat(path, &s) < 0) die("unable to access %s", path);
+	if (!S_ISDIR(s.st_mode)) {
+		add_file(path);
+		return;
 	}
-	dir = opendir(".");
+	dir = opendir(path);
 	if (!dir) die("unable to open directory");
 	while (1) {
 		f = readdir(dir);
 		if (!f) break;
 		//if ((f->d_type & DT_DIR)) continue; // skip directories
 		//if (!(f->d_type & DT_REG)) continue; // skip special files
-		if (stat(f->d_name, &s) < 0) continue; // skip if unable to stat
+		if (strcmp(path, ".") == 0) {
+			snprintf(name, sizeof(name), "%s", f->d_name);
+		} else {
+			snprintf(name, sizeof(name), "%s/%s", path, f->d_name);
+		}
+		if (stat(name, &s) < 0) continue; // skip if unable to stat
 		if (S_ISDIR(s.st_mode)) continue;  // skip directories
 		if (!S_ISREG(s.st_mode)) continue; // skip special files
-		filename = f->d_name;
-		len = strlen(filename);
-		if (len < 5) continue;
-		if (strcasecmp(filename + len - 4, ".wav") != 0) continue;
+		add_file(name);
+	}
+	closedir(dir);
+}
+
+int compare_names(const void *a, const void *b)
+{
+	return strcmp(((const struct wav_info *)a)->filename,
+	  ((const struct wav_info *)b)->filename);
+}
+
+const char *title = "// Audio data converted from WAV file by wav2sketch\n\n";
+
+FILE * create_output(const char *suffix, char *buf, int size)
+{
+	FILE *fp;
+
+	snprintf(buf, size, "AudioSample%s.%s", samplename, suffix);
+	fp = fopen(buf, "w");
+	if (fp == NULL) die("unable to write %s", buf);
+	fprintf(fp, "%s", title);
+	return fp;
+}
+
+// read, resample, trim and encode one file.  Returns the array size.
+uint32_t convert_file(const struct wav_info *w)
+{
+	FILE *fp, *outc, *outh;
+	char buf[128];
+	double *audio, *converted;
+	int16_t *samples;
+	uint32_t i, length, start=0, total, rate, arraylen;
+	int32_t n;
+
+	filename = w->filename;
+	strcpy(samplename, w->samplename);
+	report_text[0] = 0;
+	report("converting: %s  -->  AudioSample%s\n", filename, samplename);
+	fp = fopen(filename, "rb");
+	if (!fp) die("unable to read file %s", filename);
+	fseek(fp, w->offset, SEEK_SET);
+	audio = read_audio(fp, w, &length);
+	fclose(fp);
+	rate = output_rate(w->rate);
+	if (rate != w->rate) {
+		report("    resampled %d Hz to %d Hz\n", w->rate, rate);
+		converted = resample(audio, length, w->rate, rate, &length);
+		free(audio);
+		audio = converted;
+	}
+	if (trim_mode) {
+		total = length;
+		trim(audio, &start, &length);
+		if (length < total) {
+			report("    trimmed %d samples of silence at the start, %d at the end\n",
+				start, total - start - length);
+		}
+	}
+	samples = malloc(length * sizeof(int16_t) + 1);
+	if (!samples) die("out of memory converting %s", filename);
+	for (i=0; i < length; i++) {
+		n = lrint(audio[start + i]);
+		if (n > 32767) n = 32767;
+		if (n < -32768) n = -32768;
+		samples[i] = n;
+	}
+	free(audio);
+
+	outh = create_output("h", buf, sizeof(buf));
+	outc = create_output("cpp", buf, sizeof(buf));
+	fprintf(outc, "#include <Arduino.h>\n");
+	fprintf(outc, "#include \"AudioSample%s.h\"\n\n", samplename);
+	arraylen = wav2c(samples, length, rate, outc, outh);
+	fclose(outc);
+	fclose(outh);
+	free(samples);
+	fputs(report_text, stdout);
+	fflush(stdout);
+	return arraylen;
+}
+
+// a file with the same audio as another gets no array of its own,
+// only a header which refers to the other file's data
+void write_duplicate(const struct wav_info *w, const struct wav_info *original)
+{
+	FILE *outc, *outh;
+	char buf[128];
+
+	filename = w->filename;
+	strcpy(samplename, w->samplename);
+	printf("duplicate:  %s  -->  AudioSample%s, same as AudioSample%s\n",
+	  filename, samplename, original->samplename);
+	outh = create_output("h", buf, sizeof(buf));
+	fprintf(outh, "// %s is identical to %s\n", filename, original->filename);
+	fprintf(outh, "#include \"AudioSample%s.h\"\n", original->samplename);
+	fprintf(outh, "#define AudioSample%s AudioSample%s\n", samplename, original->samplename);
+	fclose(outh);
+	outc = create_output("cpp", buf, sizeof(buf));
+	fprintf(outc, "// AudioSample%s uses the data in AudioSample%s.cpp\n",
+	  samplename, original->samplename);
+	fclose(outc);
+}
+
+#ifndef _WIN32
+// wait for one converter process, stopping all of them if it failed
+uint32_t wait_process(pid_t *pids, int *running, int fd)
+{
+	uint32_t size = 0;
+	pid_t pid;
+	int i, status;
+
+	pid = wait(&status);
+	for (i=0; i < *running; i++) {
+		if (pids[i] == pid) {
+			pids[i] = pids[--*running];
+			break;
+		}
+	}
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		for (i=0; i < *running; i++) kill(pids[i], SIGTERM);
+		while (wait(NULL) > 0) ;
+		exit(1);
+	}
+	if (read(fd, &size, 4) != 4) die("lost result from converter process");
+	return size;
+}
+#endif
+
+// convert every file which isn't a duplicate, using up to "jobs"
+// processes at once.  Each process converts one file and sends its
+// array size back through a pipe.
+uint32_t convert_all(void)
+{
+	uint32_t total = 0, size;
+	int i;
+
+#ifndef _WIN32
+	if (jobs > 1) {
+		pid_t *pids = malloc(jobs * sizeof(pid_t));
+		int running = 0, fd[2];
+
+		if (!pids || pipe(fd) < 0) die("unable to start converter processes");
+		fflush(stdout);
+		for (i=0; i < list_count; i++) {
+			if (list[i].duplicate >= 0) continue;
+			if (running >= jobs) total += wait_process(pids, &running, fd[0]);
+			pids[running] = fork();
+			if (pids[running] < 0) die("unable to start converter process");
+			if (pids[running] == 0) {
+				close(fd[0]);
+				size = convert_file(&list[i]);
+				if (write(fd[1], &size, 4) != 4) exit(1);
+				exit(0);
+			}
+			running++;
+		}
+		while (running > 0) total += wait_process(pids, &running, fd[0]);
+		close(fd[0]);
+		close(fd[1]);
+		free(pids);
+		return total;
+	}
+#endif
+	for (i=0; i < list_count; i++) {
+		if (list[i].duplicate < 0) total += convert_file(&list[i]);
+	}
+	return total;
+}
+
+int main(int argc, char **argv)
+{
+	FILE *fp;
+	int i, j, duplicates=0;
+	uint32_t total_length;
+
+	// By default, audio is u-law encoded to reduce the memory requirement
+	// in half.  However, u-law does add distortion.  If "-16" is specified
+	// on the command line, the original 16 bit PCM samples are used.
+	// "-adpcm" uses 4 bit IMA-ADPCM, half the size of u-law and usually
+	// better quality.  The SNR of each lossy file is printed, to compare.
+	//
+	// Files may be 8, 16, 24 or 32 bit integer, or 32 or 64 bit float,
+	// with any number of channels, mixed to mono.  Rates other than
+	// 44100, 22050 and 11025 are resampled to the next higher of these,
+	// or all files to one rate with "-rate 22050" for example.  "-trim"
+	// removes silence from the beginning and end.  Files with identical
+	// audio are stored only once.
+	//
+	// Directories or files to convert may be given, otherwise all files
+	// in the current directory are used.  Output is always written to
+	// the current directory.  Files are converted in parallel, using one
+	// process per CPU, or "-j 1" to use only one.
+#if !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+	jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (jobs < 1) jobs = 1;
+#endif
+	for (i=1; i < argc; i++) {
+		if (strcmp(argv[i], "-16") == 0) {
+			pcm_mode = 1;
+		} else if (strcmp(argv[i], "-adpcm") == 0) {
+			adpcm_mode = 1;
+		} else if (strcmp(argv[i], "-trim") == 0) {
+			trim_mode = 1;
+		} else if (strcmp(argv[i], "-rate") == 0 && i + 1 < argc) {
+			target_rate = atoi(argv[++i]);
+			if (target_rate != 44100 && target_rate != 22050 && target_rate != 11025)
+				die("rate must be 44100, 22050 or 11025");
+		} else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+			jobs = atoi(argv[++i]);
+			if (jobs < 1) jobs = 1;
+		} else if (argv[i][0] == '-') {
+			die("unknown option %s\n"
+			  "usage: wav2sketch [-16 | -adpcm] [-rate hz] [-trim] [-j n] [paths...]", argv[i]);
+		} else {
+			add_path(argv[i]);
+		}
+	}
+	if (adpcm_mode) pcm_mode = 0;
+	if (list_count == 0) add_path(".");
+	qsort(list, list_count, sizeof(struct wav_info), compare_names);
+
+	// read every header first, so any bad file stops before
+	// output begins, and find the files with identical audio
+	for (i=0; i < list_count; i++) {
+		filename = list[i].filename;
 		fp = fopen(filename, "rb");
 		if (!fp) die("unable to read file %s", filename);
-		filename2samplename();
-		printf("converting: %s  -->  AudioSample%s\n", filename, samplename);
-		snprintf(buf, sizeof(buf), "AudioSample%s.cpp", samplename);
-		outc = fopen(buf, "w");
-		if (outc == NULL) die("unable to write %s", buf);
-		snprintf(buf, sizeof(buf), "AudioSample%s.h", samplename);
-		outh = fopen(buf, "w");
-		if (outh == NULL) die("unable to write %s\n", buf);
-		fprintf(outh, "%s", title);
-		fprintf(outc, "%s", title);
-		fprintf(outc, "#include <Arduino.h>\n");
-		fprintf(outc, "#include \"%s\"\n\n", buf);
-		wav2c(fp, outc, outh);
-		//wav2c(fp, stdout, stdout);
-		fclose(outc);
-		fclose(outh);
+		read_header(fp, &list[i]);
+		list[i].hash = hash_audio(fp, &list[i]);
 		fclose(fp);
+		filename2samplename();
+		strcpy(list[i].samplename, samplename);
+		for (j=0; j < i; j++) {
+			if (list[j].duplicate < 0 && list[j].hash == list[i].hash
+			  && same_audio(&list[j], &list[i])) {
+				list[i].duplicate = j;
+				break;
+			}
+		}
 	}
+
+	total_length = convert_all();
+	for (i=0; i < list_count; i++) {
+		if (list[i].duplicate >= 0) {
+			write_duplicate(&list[i], &list[list[i].duplicate]);
+			duplicates++;
+		}
+	}
+	if (duplicates > 0) printf("%d duplicate files share data\n", duplicates);
 	printf("Total data size %d bytes\n", total_length * 4);
 	return 0;
 }
@@ -345,6 +974,26 @@ uint32_t read_uint32(FILE *in)
 	return (c4 << 24) | (c3 << 16) | (c2 << 8) | c1;
 }
 
+void skip(FILE *in, uint32_t count)
+{
+	while (count > 0) {
+		read_uint8(in);
+		count--;
+	}
+}
+
+// add to the text printed after each file, all at once so the output
+// of parallel conversions doesn't get mixed together
+void report(const char *format, ...)
+{
+	int len = strlen(report_text);
+	va_list args;
+
+	va_start(args, format);
+	vsnprintf(report_text + len, sizeof(report_text) - len, format, args);
+	va_end(args);
+}
+
 void die(const char *format, ...)
 {
 	va_list args;
@@ -10,7 +10,7 @@
   Read data from audio file as a series of floating point numbers
   Convert these floating point numbers to unsigned integers
   Add padding required by Teensy audio library
-  Pack unsigned integers into 32-bit words, with u-law encoding if desired
+  Pack unsigned integers into 32-bit words, with u-law or IMA-ADPCM encoding if desired
 */
 
 var audioFileChooser = document.getElementById('audioFileChooser');
@@ -73,8 +73,13 @@ function processFile(file, fileName, sampleRateChoice, encodingChoice) {
     var encodingCode = '0';
     var sampleRateCode;
     if(encoding == 'u-law') encodingCode = '0';
+    else if(encoding == 'IMA-ADPCM') encodingCode = '4';
     else encodingCode = '8'; // PCM
-    if(sampleRate == 44100) {
+    if(encoding == 'IMA-ADPCM') {
+      // ADPCM is stored in blocks of 128 samples at any rate
+      padLength = padding(monoData.length, 128);
+      sampleRateCode = sampleRate == 44100 ? '1' : (sampleRate == 22050 ? '2' : '3');
+    } else if(sampleRate == 44100) {
       padLength = padding(monoData.length, 128);
       sampleRateCode = '1';
     } else if(sampleRate == 22050) {
@@ -93,6 +98,8 @@ function processFile(file, fileName, sampleRateChoice, encodingChoice) {
     var outputData;
     if(encoding == 'u-law') {
       outputData = createULawWords(ulawOut, padLength);
+    } else if(encoding == 'IMA-ADPCM') {
+      outputData = createADPCMWords(monoData, padLength);
     } else {
       outputData = createWords(monoData, padLength);
     }
@@ -175,6 +182,65 @@ function createULawWords(audioData, padLength) {
   return outputData;
 }
 
+// IMA-ADPCM tables, the same as data_adpcm.c in the library
+var adpcmStepTable = [
+     7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+   130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+   337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+   876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+  2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+  5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+ 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767];
+var adpcmIndexTable = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8];
+
+// each block of 128 samples is one word of decoder state (predictor,
+// step index) followed by 16 words of 4 bit codes, first sample lowest
+function createADPCMWords(audioData, padLength) {
+  var totalLength = audioData.length + padLength;
+  var outputData = [];
+  var predict = 0, index = 0;
+  for(var i = 0; i < totalLength; i += 128) {
+    outputData.push(toHexWord(modulo(predict, 65536) + 65536 * index));
+    for(var j = 0; j < 128; j += 8) {
+      var word = 0;
+      for(var k = 0; k < 8; k++) {
+        var n = i + j + k;
+        var audio = n < audioData.length ? toInteger(audioData[n]*0x7fff) : 0;
+        // choose the code which decodes closest to the original
+        var step = adpcmStepTable[index];
+        var best = 0, bestPredict = 0, bestErr = Infinity;
+        for(var code = 0; code < 16; code++) {
+          var diff = step >> 3;
+          if(code & 4) diff += step;
+          if(code & 2) diff += step >> 1;
+          if(code & 1) diff += step >> 2;
+          if(code & 8) diff = -diff;
+          var p = Math.max(-32768, Math.min(32767, predict + diff));
+          var err = Math.abs(audio - p);
+          if(err < bestErr) {
+            bestErr = err;
+            bestPredict = p;
+            best = code;
+          }
+        }
+        predict = bestPredict;
+        index = Math.max(0, Math.min(88, index + adpcmIndexTable[best]));
+        word += best * Math.pow(16, k);
+      }
+      outputData.push(toHexWord(word));
+    }
+  }
+  return outputData;
+}
+
+function toHexWord(x) {
+  var out = x.toString(16);
+  while(out.length < 8) out = '0' + out;
+  return '0x' + out;
+}
+
 // http://2ality.com/2012/02/js-integers.html
 function toInteger(x) {
   x = Number(x);
@@ -27,6 +27,7 @@
 #include <Arduino.h>
 #include "filter_biquad.h"
 #include "utility/dspinst.h"
+#include "utility/tail.h"
 
 #if defined(__ARM_ARCH_7EM__)
 
@@ -37,8 +38,29 @@ void AudioFilterBiquad::update(void)
 	uint32_t in2, out2, bprev, aprev, flag;
 	uint32_t *data, *end;
 	int32_t *state;
+	bool silent = false;
+
 	block = receiveWritable();
-	if (!block) return;
+	if (block) {
+		// The tail is run only for a signal with a block on every
+		// update.  A signal which skips updates, like the output of
+		// AudioFilterDecimate, must not get zeros between its blocks.
+		tail_run = had_input;
+		had_input = true;
+		tail_remain = tail_blocks;
+	} else {
+		had_input = false;
+		// without input, run only until the tail has decayed
+		if (tail_remain == 0) return;
+		if (!tail_run) {
+			tail_remain--;
+			return;
+		}
+		block = allocate();
+		if (!block) return;
+		memset(block->data, 0, sizeof(block->data));
+		silent = true;
+	}
 	end = (uint32_t *)(block->data) + AUDIO_BLOCK_SAMPLES/2;
 	state = (int32_t *)definition;
 	do {
@@ -82,6 +104,22 @@ void AudioFilterBiquad::update(void)
 		*(state-2) = aprev;
 		*(state-3) = bprev;
 	} while (flag);
+	if (silent) {
+		// Rounding can leave a small limit cycle rather than silence,
+		// so the tail ends after its computed decay time, or sooner
+		// if the output reaches zero.  Either way, clear the state.
+		if (--tail_remain == 0 || tail_quiet(block->data, 0)) {
+			tail_remain = 0;
+			state = (int32_t *)definition;
+			do {
+				state[5] = 0;
+				state[6] = 0;
+				flag = state[7] & 0x80000000;
+				state[7] = flag;
+				state += 8;
+			} while (flag);
+		}
+	}
 	transmit(block);
 	release(block);
 }
@@ -102,6 +140,32 @@ void AudioFilterBiquad::setCoefficients(uint32_t stage, const int *coefficients)
 	dest += 2;
 	*dest   &= 0x80000000;
 	__enable_irq();
+
+	// Estimate how long the filter rings: the slowest pole of every
+	// stage must decay by 96 dB, and the tails of cascaded stages add.
+	float samples = 0.0f;
+	const int32_t *p = definition;
+	uint32_t flag;
+	do {
+		float a1 = (float)p[3] * (-1.0f / 1073741824.0f);
+		float a2 = (float)p[4] * (-1.0f / 1073741824.0f);
+		float disc = a1 * a1 - 4.0f * a2;
+		float r = (disc < 0.0f) ? sqrtf(a2) : (fabsf(a1) + sqrtf(disc)) * 0.5f;
+		if (r >= 0.99999f) {
+			samples = 65535.0f * AUDIO_BLOCK_SAMPLES;
+			break;
+		}
+		if (r > 0.0f) samples += -11.05f / logf(r);
+		flag = p[7] & 0x80000000;
+		p += 8;
+	} while (flag);
+	if (samples > 65534.0f * AUDIO_BLOCK_SAMPLES) samples = 65534.0f * AUDIO_BLOCK_SAMPLES;
+	tail_blocks = (uint32_t)(samples / AUDIO_BLOCK_SAMPLES) + 1;
+}
+
+bool AudioFilterBiquad::isActive(void)
+{
+	return *(volatile uint16_t *)&tail_remain > 0;
 }
 
 #elif defined(KINETISL)
@@ -118,4 +182,9 @@ void AudioFilterBiquad::setCoefficients(uint32_t stage, const int *coefficients)
 {
 }
 
+bool AudioFilterBiquad::isActive(void)
+{
+	return false;
+}
+
 #endif
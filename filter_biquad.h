@@ -36,8 +36,14 @@ public:
 	AudioFilterBiquad(void) : AudioStream(1, inputQueueArray) {
 		// by default, the filter will not pass anything
 		for (int i=0; i<32; i++) definition[i] = 0;
+		tail_blocks = 1;
+		tail_remain = 0;
+		had_input = false;
+		tail_run = false;
 	}
 	virtual void update(void);
+	// true while input is present or the filter is still ringing
+	bool isActive(void);
 
 	// Set the biquad coefficients directly
 	void setCoefficients(uint32_t stage, const int *coefficients);
@@ -150,6 +156,10 @@ public:
 
 private:
 	int32_t definition[32];  // up to 4 cascaded biquads
+	uint16_t tail_blocks;    // decay time after input stops
+	uint16_t tail_remain;
+	bool had_input;          // the previous update received a block
+	bool tail_run;           // input arrived on consecutive updates
 	audio_block_t *inputQueueArray[1];
 };
 
@@ -0,0 +1,157 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef filter_biquad_f32_h_
+#define filter_biquad_f32_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+// Floating point version of AudioFilterBiquad, with the same functions.
+// Coefficients are used without any scaling, so very low frequencies
+// and high Q settings keep their precision.
+class AudioFilterBiquad_F32 : public AudioStream_F32
+{
+public:
+	AudioFilterBiquad_F32(void) : AudioStream_F32(0, NULL, 1, inputQueueArray_f32) {
+		// by default, the filter will not pass anything
+		memset(coeffs, 0, sizeof(coeffs));
+		arm_biquad_cascade_df2T_init_f32(&filter, 4, coeffs, state);
+		filter.numStages = 0;
+	}
+	virtual void update(void);
+
+	// Set the biquad coefficients directly: b0, b1, b2, a1, a2
+	void setCoefficients(uint32_t stage, const float *coefficients);
+	void setCoefficients(uint32_t stage, const double *coefficients) {
+		float coef[5];
+		for (int i=0; i < 5; i++) coef[i] = coefficients[i];
+		setCoefficients(stage, coef);
+	}
+
+	// Compute common filter functions
+	// http://www.musicdsp.org/files/Audio-EQ-Cookbook.txt
+	void setLowpass(uint32_t stage, float frequency, float q = 0.7071f) {
+		double coef[5];
+		double w0 = frequency * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		double sinW0 = sin(w0);
+		double alpha = sinW0 / ((double)q * 2.0);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		/* b0 */ coef[0] = ((1.0 - cosW0) / 2.0) * scale;
+		/* b1 */ coef[1] = (1.0 - cosW0) * scale;
+		/* b2 */ coef[2] = coef[0];
+		/* a1 */ coef[3] = (-2.0 * cosW0) * scale;
+		/* a2 */ coef[4] = (1.0 - alpha) * scale;
+		setCoefficients(stage, coef);
+	}
+	void setHighpass(uint32_t stage, float frequency, float q = 0.7071f) {
+		double coef[5];
+		double w0 = frequency * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		double sinW0 = sin(w0);
+		double alpha = sinW0 / ((double)q * 2.0);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		/* b0 */ coef[0] = ((1.0 + cosW0) / 2.0) * scale;
+		/* b1 */ coef[1] = -(1.0 + cosW0) * scale;
+		/* b2 */ coef[2] = coef[0];
+		/* a1 */ coef[3] = (-2.0 * cosW0) * scale;
+		/* a2 */ coef[4] = (1.0 - alpha) * scale;
+		setCoefficients(stage, coef);
+	}
+	void setBandpass(uint32_t stage, float frequency, float q = 1.0f) {
+		double coef[5];
+		double w0 = frequency * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		double sinW0 = sin(w0);
+		double alpha = sinW0 / ((double)q * 2.0);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		/* b0 */ coef[0] = alpha * scale;
+		/* b1 */ coef[1] = 0;
+		/* b2 */ coef[2] = (-alpha) * scale;
+		/* a1 */ coef[3] = (-2.0 * cosW0) * scale;
+		/* a2 */ coef[4] = (1.0 - alpha) * scale;
+		setCoefficients(stage, coef);
+	}
+	void setNotch(uint32_t stage, float frequency, float q = 1.0f) {
+		double coef[5];
+		double w0 = frequency * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		double sinW0 = sin(w0);
+		double alpha = sinW0 / ((double)q * 2.0);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		/* b0 */ coef[0] = scale;
+		/* b1 */ coef[1] = (-2.0 * cosW0) * scale;
+		/* b2 */ coef[2] = coef[0];
+		/* a1 */ coef[3] = (-2.0 * cosW0) * scale;
+		/* a2 */ coef[4] = (1.0 - alpha) * scale;
+		setCoefficients(stage, coef);
+	}
+	void setLowShelf(uint32_t stage, float frequency, float gain, float slope = 1.0f) {
+		double coef[5];
+		double a = pow(10.0, gain/40.0);
+		double w0 = frequency * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		double sinW0 = sin(w0);
+		double cosW0 = cos(w0);
+		double sinsq = sinW0 * sqrt( (pow(a,2.0)+1.0)*(1.0/(double)slope-1.0)+2.0*a );
+		double aMinus = (a-1.0)*cosW0;
+		double aPlus = (a+1.0)*cosW0;
+		double scale = 1.0 / ( (a+1.0) + aMinus + sinsq);
+		/* b0 */ coef[0] =      a * ( (a+1.0) - aMinus + sinsq ) * scale;
+		/* b1 */ coef[1] =  2.0*a * ( (a-1.0) - aPlus          ) * scale;
+		/* b2 */ coef[2] =      a * ( (a+1.0) - aMinus - sinsq ) * scale;
+		/* a1 */ coef[3] = -2.0 *   ( (a-1.0) + aPlus          ) * scale;
+		/* a2 */ coef[4] =          ( (a+1.0) + aMinus - sinsq ) * scale;
+		setCoefficients(stage, coef);
+	}
+	void setHighShelf(uint32_t stage, float frequency, float gain, float slope = 1.0f) {
+		double coef[5];
+		double a = pow(10.0, gain/40.0);
+		double w0 = frequency * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		double sinW0 = sin(w0);
+		double cosW0 = cos(w0);
+		double sinsq = sinW0 * sqrt( (pow(a,2.0)+1.0)*(1.0/(double)slope-1.0)+2.0*a );
+		double aMinus = (a-1.0)*cosW0;
+		double aPlus = (a+1.0)*cosW0;
+		double scale = 1.0 / ( (a+1.0) - aMinus + sinsq);
+		/* b0 */ coef[0] =      a * ( (a+1.0) + aMinus + sinsq ) * scale;
+		/* b1 */ coef[1] = -2.0*a * ( (a-1.0) + aPlus          ) * scale;
+		/* b2 */ coef[2] =      a * ( (a+1.0) + aMinus - sinsq ) * scale;
+		/* a1 */ coef[3] =  2.0 *   ( (a-1.0) - aPlus          ) * scale;
+		/* a2 */ coef[4] =          ( (a+1.0) - aMinus - sinsq ) * scale;
+		setCoefficients(stage, coef);
+	}
+
+private:
+	float coeffs[4*5];  // up to 4 cascaded biquads
+	float state[4*2];
+	arm_biquad_cascade_df2T_instance_f32 filter;
+	audio_block_f32_t *inputQueueArray_f32[1];
+};
+
+#endif
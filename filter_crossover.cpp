@@ -0,0 +1,185 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "filter_crossover.h"
+#include "utility/dspinst.h"
+#include "utility/inplace.h"
+
+// Coefficients are b0, b1, b2, a1, a2, with the a terms negated for
+// arm_biquad_cascade_df2T_f32.  LR2 uses a single stage (2 cascaded
+// first order Butterworth sections) and LR4 uses 2 identical stages of
+// second order Butterworth, Q = 0.7071.  The unused stage of LR2 is
+// left as a pass-through.
+
+static void set_coefs(float *coef, double b0, double b1, double b2,
+	double a1, double a2)
+{
+	coef[0] = b0;
+	coef[1] = b1;
+	coef[2] = b2;
+	coef[3] = -a1;
+	coef[4] = -a2;
+}
+
+void AudioFilterCrossover::lowpass(float *coef, double w0, bool lr4)
+{
+	if (lr4) {
+		double alpha = sin(w0) / (2.0 * 0.70710678);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		set_coefs(coef, (1.0 - cosW0) / 2.0 * scale, (1.0 - cosW0) * scale,
+			(1.0 - cosW0) / 2.0 * scale, -2.0 * cosW0 * scale,
+			(1.0 - alpha) * scale);
+		memcpy(coef + 5, coef, 5 * sizeof(float));
+	} else {
+		double k = tan(w0 / 2.0);
+		double a = (k - 1.0) / (k + 1.0);
+		double g = (k / (k + 1.0)) * (k / (k + 1.0));
+		set_coefs(coef, g, 2.0 * g, g, 2.0 * a, a * a);
+		set_coefs(coef + 5, 1.0, 0.0, 0.0, 0.0, 0.0);
+	}
+}
+
+void AudioFilterCrossover::highpass(float *coef, double w0, bool lr4)
+{
+	if (lr4) {
+		double alpha = sin(w0) / (2.0 * 0.70710678);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		set_coefs(coef, (1.0 + cosW0) / 2.0 * scale, -(1.0 + cosW0) * scale,
+			(1.0 + cosW0) / 2.0 * scale, -2.0 * cosW0 * scale,
+			(1.0 - alpha) * scale);
+		memcpy(coef + 5, coef, 5 * sizeof(float));
+	} else {
+		// LR2 high pass is inverted, so the bands sum to an
+		// allpass rather than a notch at the crossover frequency
+		double k = tan(w0 / 2.0);
+		double a = (k - 1.0) / (k + 1.0);
+		double g = -1.0 / ((k + 1.0) * (k + 1.0));
+		set_coefs(coef, g, -2.0 * g, g, 2.0 * a, a * a);
+		set_coefs(coef + 5, 1.0, 0.0, 0.0, 0.0, 0.0);
+	}
+}
+
+// Allpass equal to the sum of this split's low and high pass outputs
+void AudioFilterCrossover::allpass(float *coef, double w0, bool lr4)
+{
+	if (lr4) {
+		double alpha = sin(w0) / (2.0 * 0.70710678);
+		double cosW0 = cos(w0);
+		double scale = 1.0 / (1.0 + alpha);
+		set_coefs(coef, (1.0 - alpha) * scale, -2.0 * cosW0 * scale,
+			1.0, -2.0 * cosW0 * scale, (1.0 - alpha) * scale);
+	} else {
+		double k = tan(w0 / 2.0);
+		double a = (k - 1.0) / (k + 1.0);
+		set_coefs(coef, a, 1.0, 0.0, a, 0.0);
+	}
+}
+
+void AudioFilterCrossover::configure(void)
+{
+	float lowc[3][4*5];
+	float highc[3][2*5];
+	uint8_t lowStages[3];
+	uint8_t highStages[3];
+	const unsigned int splits = numbands - 1;
+
+	// all 3 splits are always configured, so update() never sees an
+	// uninitialized filter when the number of bands changes
+	for (unsigned int k=0; k < 3; k++) {
+		double w0 = freq[k] * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+		lowpass(lowc[k], w0, lr4);
+		unsigned int n = lr4 ? 2 : 1;
+		if (compensate) {
+			// this band must also pass through every later split
+			for (unsigned int j=k+1; j < splits; j++) {
+				double wj = freq[j] * (2.0 * 3.141592654 / AUDIO_SAMPLE_RATE_EXACT);
+				allpass(lowc[k] + n * 5, wj, lr4);
+				n++;
+			}
+		}
+		lowStages[k] = n;
+		highpass(highc[k], w0, lr4);
+		highStages[k] = lr4 ? 2 : 1;
+	}
+	__disable_irq();
+	for (unsigned int k=0; k < 3; k++) {
+		memcpy(lowCoeffs[k], lowc[k], lowStages[k] * 5 * sizeof(float));
+		memcpy(highCoeffs[k], highc[k], highStages[k] * 5 * sizeof(float));
+		// the state is kept, so changing frequency does not pop
+		lowFilter[k].numStages = lowStages[k];
+		lowFilter[k].pState = lowState[k];
+		lowFilter[k].pCoeffs = lowCoeffs[k];
+		highFilter[k].numStages = highStages[k];
+		highFilter[k].pState = highState[k];
+		highFilter[k].pCoeffs = highCoeffs[k];
+	}
+	__enable_irq();
+}
+
+void AudioFilterCrossover::update(void)
+{
+	audio_block_t *block, *out;
+	float buf[3][AUDIO_BLOCK_SAMPLES];
+	float *rest = buf[0];
+	float *high = buf[1];
+	float *low = buf[2];
+	unsigned int k, i;
+
+	block = receiveReadOnly();
+	if (!block) return;
+	arm_q15_to_float(block->data, rest, AUDIO_BLOCK_SAMPLES);
+	// once converted, the input may be reused for the first output
+	out = inplace_output(block, allocate);
+	if (out != block) release(block);
+
+	const unsigned int splits = numbands - 1;
+	for (k=0; k < splits; k++) {
+		arm_biquad_cascade_df2T_f32(&lowFilter[k], rest, low, AUDIO_BLOCK_SAMPLES);
+		arm_biquad_cascade_df2T_f32(&highFilter[k], rest, high, AUDIO_BLOCK_SAMPLES);
+		if (k > 0) out = allocate();
+		if (out) {
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				out->data[i] = saturate16((int32_t)(low[i] * 32768.0f));
+			}
+			transmit(out, k);
+			release(out);
+		}
+		float *tmp = rest;
+		rest = high;
+		high = tmp;
+	}
+	if (k > 0) out = allocate();
+	if (out) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			out->data[i] = saturate16((int32_t)(rest[i] * 32768.0f));
+		}
+		transmit(out, k);
+		release(out);
+	}
+}
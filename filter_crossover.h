@@ -0,0 +1,97 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef filter_crossover_h_
+#define filter_crossover_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "arm_math.h"
+
+enum AudioFilterCrossoverType {
+	CROSSOVER_LR2,
+	CROSSOVER_LR4
+};
+
+// Linkwitz-Riley crossover, splitting 1 input into 2 to 4 bands in a
+// single pass.  Each split feeds its high pass output into the next
+// split, and the lower bands are passed through allpass filters matching
+// the later splits, so all outputs have the same phase and sum flat.
+class AudioFilterCrossover : public AudioStream
+{
+public:
+	AudioFilterCrossover(void) : AudioStream(1, inputQueueArray),
+	  numbands(2), lr4(true), compensate(true) {
+		memset(lowState, 0, sizeof(lowState));
+		memset(highState, 0, sizeof(highState));
+		freq[0] = 200.0f;
+		freq[1] = 2000.0f;
+		freq[2] = 8000.0f;
+		configure();
+	}
+	void bands(unsigned int n) {
+		if (n < 2) n = 2;
+		else if (n > 4) n = 4;
+		numbands = n;
+		configure();
+	}
+	void frequency(unsigned int n, float hz) {
+		if (n >= 3) return;
+		if (hz < 10.0f) hz = 10.0f;
+		else if (hz > AUDIO_SAMPLE_RATE_EXACT * 0.45f) hz = AUDIO_SAMPLE_RATE_EXACT * 0.45f;
+		freq[n] = hz;
+		configure();
+	}
+	void type(AudioFilterCrossoverType t) {
+		lr4 = (t == CROSSOVER_LR4);
+		configure();
+	}
+	void compensation(bool enable) {
+		compensate = enable;
+		configure();
+	}
+	virtual void update(void);
+private:
+	void configure(void);
+	static void lowpass(float *coef, double w0, bool lr4);
+	static void highpass(float *coef, double w0, bool lr4);
+	static void allpass(float *coef, double w0, bool lr4);
+	audio_block_t *inputQueueArray[1];
+	float freq[3];
+	uint8_t numbands;
+	bool lr4;
+	bool compensate;
+	// low bands: 2 lowpass + up to 2 allpass stages, 5 coefficients each
+	float lowCoeffs[3][4*5];
+	float lowState[3][4*2];
+	arm_biquad_cascade_df2T_instance_f32 lowFilter[3];
+	// high pass feeding the next split: 2 stages
+	float highCoeffs[3][2*5];
+	float highState[3][2*2];
+	arm_biquad_cascade_df2T_instance_f32 highFilter[3];
+};
+
+#endif
@@ -0,0 +1,227 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "filter_decimate.h"
+#include "utility/dspinst.h"
+
+// blocks of silence needed before a filter with this many taps (at the
+// input rate) holds only zeros
+static uint8_t flush_blocks(unsigned int taps)
+{
+	return (taps + AUDIO_BLOCK_SAMPLES - 1) / AUDIO_BLOCK_SAMPLES;
+}
+
+bool AudioFilterDecimate::begin(unsigned int factor, AudioOversampleQuality quality)
+{
+	if (factor != 2 && factor != 4 && factor != 8) {
+		end();
+		return factor == 1;
+	}
+	float *c = (float *)malloc(32 * factor * sizeof(float));
+	float *s = (float *)malloc((32 * factor + AUDIO_BLOCK_SAMPLES - 1) * sizeof(float));
+	if (!c || !s) {
+		free(c);
+		free(s);
+		return false;
+	}
+	unsigned int ntaps = Oversampler::design(c, factor, quality);
+	arm_fir_decimate_instance_f32 de;
+	if (arm_fir_decimate_init_f32(&de, ntaps, factor, c, s,
+	  AUDIO_BLOCK_SAMPLES) != ARM_MATH_SUCCESS) {
+		free(c);
+		free(s);
+		return false;
+	}
+	__disable_irq();
+	float *oldc = coeffs;
+	float *olds = state;
+	decimation = de;
+	coeffs = c;
+	state = s;
+	count = 0;
+	quiet = 0;
+	heard = false;
+	ratio = factor;
+	__enable_irq();
+	free(oldc);
+	free(olds);
+	return true;
+}
+
+void AudioFilterDecimate::end(void)
+{
+	__disable_irq();
+	float *oldc = coeffs;
+	float *olds = state;
+	coeffs = NULL;
+	state = NULL;
+	ratio = 1;
+	__enable_irq();
+	free(oldc);
+	free(olds);
+}
+
+void AudioFilterDecimate::update(void)
+{
+	audio_block_t *block;
+	float in[AUDIO_BLOCK_SAMPLES];
+	const unsigned int outlen = AUDIO_BLOCK_SAMPLES / ratio;
+	float *out = output + count * outlen;
+
+	block = receiveReadOnly();
+	if (ratio == 1) {
+		if (block) {
+			transmit(block);
+			release(block);
+		}
+		return;
+	}
+	if (block) {
+		arm_q15_to_float(block->data, in, AUDIO_BLOCK_SAMPLES);
+		release(block);
+		arm_fir_decimate_f32(&decimation, in, out, AUDIO_BLOCK_SAMPLES);
+		quiet = 0;
+		heard = true;
+	} else if (quiet < flush_blocks(decimation.numTaps)) {
+		// no input, but the filter still holds earlier signal
+		memset(in, 0, sizeof(in));
+		arm_fir_decimate_f32(&decimation, in, out, AUDIO_BLOCK_SAMPLES);
+		quiet++;
+	} else {
+		// filter is empty, the output is silent
+		memset(out, 0, outlen * sizeof(float));
+	}
+	if (++count < ratio) return;
+	count = 0;
+	if (!heard && quiet >= flush_blocks(decimation.numTaps)) return;
+	heard = false;
+	block = allocate();
+	if (!block) return;
+	arm_float_to_q15(output, block->data, AUDIO_BLOCK_SAMPLES);
+	transmit(block);
+	release(block);
+}
+
+bool AudioFilterInterpolate::begin(unsigned int factor, AudioOversampleQuality quality)
+{
+	if (factor != 2 && factor != 4 && factor != 8) {
+		end();
+		return factor == 1;
+	}
+	float *c = (float *)malloc(32 * factor * sizeof(float));
+	float *s = (float *)malloc((32 + AUDIO_BLOCK_SAMPLES - 1) * sizeof(float));
+	float *b = (float *)malloc(factor * AUDIO_BLOCK_SAMPLES * sizeof(float));
+	if (!c || !s || !b) {
+		free(c);
+		free(s);
+		free(b);
+		return false;
+	}
+	unsigned int ntaps = Oversampler::design(c, factor, quality);
+	// the interpolator inserts zeros, so gain must be restored
+	for (unsigned int i=0; i < ntaps; i++) {
+		c[i] *= (float)factor;
+	}
+	arm_fir_interpolate_instance_f32 in;
+	if (arm_fir_interpolate_init_f32(&in, factor, ntaps, c, s,
+	  AUDIO_BLOCK_SAMPLES) != ARM_MATH_SUCCESS) {
+		free(c);
+		free(s);
+		free(b);
+		return false;
+	}
+	__disable_irq();
+	float *oldc = coeffs;
+	float *olds = state;
+	float *oldb = buffer;
+	interpolation = in;
+	coeffs = c;
+	state = s;
+	buffer = b;
+	slice = factor;
+	tail = 0;
+	ratio = factor;
+	__enable_irq();
+	free(oldc);
+	free(olds);
+	free(oldb);
+	return true;
+}
+
+void AudioFilterInterpolate::end(void)
+{
+	__disable_irq();
+	float *oldc = coeffs;
+	float *olds = state;
+	float *oldb = buffer;
+	coeffs = NULL;
+	state = NULL;
+	buffer = NULL;
+	ratio = 1;
+	__enable_irq();
+	free(oldc);
+	free(olds);
+	free(oldb);
+}
+
+void AudioFilterInterpolate::update(void)
+{
+	audio_block_t *block;
+	float in[AUDIO_BLOCK_SAMPLES];
+
+	block = receiveReadOnly();
+	if (ratio == 1) {
+		if (block) {
+			transmit(block);
+			release(block);
+		}
+		return;
+	}
+	if (block) {
+		// a new decimated block starts the next "factor" output blocks
+		arm_q15_to_float(block->data, in, AUDIO_BLOCK_SAMPLES);
+		release(block);
+		arm_fir_interpolate_f32(&interpolation, in, buffer, AUDIO_BLOCK_SAMPLES);
+		slice = 0;
+		tail = flush_blocks(interpolation.phaseLength);
+	} else if (slice >= ratio) {
+		if (tail == 0) return;
+		// no new input, but the filter still holds earlier signal
+		memset(in, 0, sizeof(in));
+		arm_fir_interpolate_f32(&interpolation, in, buffer, AUDIO_BLOCK_SAMPLES);
+		slice = 0;
+		tail--;
+	}
+	block = allocate();
+	if (block) {
+		arm_float_to_q15(buffer + slice * AUDIO_BLOCK_SAMPLES, block->data,
+			AUDIO_BLOCK_SAMPLES);
+		transmit(block);
+		release(block);
+	}
+	slice++;
+}
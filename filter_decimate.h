@@ -0,0 +1,96 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef filter_decimate_h_
+#define filter_decimate_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "Oversampler.h"
+#include "arm_math.h"
+
+// Multi-rate processing.  AudioFilterDecimate lowpass filters its input
+// and keeps 1 of every 2, 4 or 8 samples.  It transmits a full block only
+// once every "factor" updates.  An analysis branch which needs only a
+// few kHz of bandwidth then costs about 1/factor of the CPU time.
+// AudioFilterInterpolate converts such a signal back to the full sample
+// rate, one block per update.
+//
+// Only objects which do nothing on an update without input may follow
+// the decimator: the mixers, amplifier, FIR, biquad and state variable
+// filters, the peak, FFT, note frequency and tone detect analyzers,
+// AudioRecordQueue and AudioFilterInterpolate.  Objects which treat
+// missing input as silence get the wrong result.  AudioAnalyzeRMS reads
+// a level diluted by 1/factor, AudioEffectDelay and the dynamics objects
+// with look-ahead mix blocks of silence into the delayed signal, and the
+// reverbs run their tails between the blocks.
+//
+// Objects after AudioFilterDecimate run at AUDIO_SAMPLE_RATE_EXACT /
+// factor, so frequency settings must be multiplied by the factor, and
+// measured frequencies divided by it.
+
+class AudioFilterDecimate : public AudioStream
+{
+public:
+	AudioFilterDecimate(void) : AudioStream(1, inputQueueArray),
+	  ratio(1), count(0), quiet(0), heard(false), coeffs(NULL), state(NULL) { }
+	~AudioFilterDecimate() { end(); }
+	bool begin(unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM);
+	void end(void);
+	virtual void update(void);
+private:
+	audio_block_t *inputQueueArray[1];
+	volatile uint8_t ratio;
+	uint8_t count;     // input blocks collected toward the next output
+	uint8_t quiet;     // consecutive updates without any input
+	bool heard;        // any input during this output block
+	float *coeffs;
+	float *state;
+	arm_fir_decimate_instance_f32 decimation;
+	float output[AUDIO_BLOCK_SAMPLES];
+};
+
+class AudioFilterInterpolate : public AudioStream
+{
+public:
+	AudioFilterInterpolate(void) : AudioStream(1, inputQueueArray),
+	  ratio(1), slice(0), tail(0), coeffs(NULL), state(NULL), buffer(NULL) { }
+	~AudioFilterInterpolate() { end(); }
+	bool begin(unsigned int factor, AudioOversampleQuality quality = OVERSAMPLE_QUALITY_MEDIUM);
+	void end(void);
+	virtual void update(void);
+private:
+	audio_block_t *inputQueueArray[1];
+	volatile uint8_t ratio;
+	uint8_t slice;     // next part of buffer to transmit
+	uint8_t tail;      // silent input blocks still needed to empty the filter
+	float *coeffs;
+	float *state;
+	float *buffer;
+	arm_fir_interpolate_instance_f32 interpolation;
+};
+
+#endif
@@ -22,6 +22,7 @@
 
 #include <Arduino.h>
 #include "filter_fir.h"
+#include "utility/inplace.h"
 
 
 void AudioFilterFIR::update(void)
@@ -45,15 +46,19 @@ void AudioFilterFIR::update(void)
 		return;
 	}
 
-	// get a block for the FIR output
-	b_new = allocate();
+	// get a block for the FIR output, or reuse the input.  The FIR
+	// copies each group of input samples into its state before writing
+	// the outputs, so in place processing is safe.
+	b_new = inplace_output(block, allocate);
+	if (b_new != block) account_allocate(b_new);
 	if (b_new) {
 		arm_fir_fast_q15(&fir_inst, (q15_t *)block->data,
 			(q15_t *)b_new->data, AUDIO_BLOCK_SAMPLES);
 		transmit(b_new); // send the FIR output
 		release(b_new);
+		if (b_new != block) account_remove();
 	}
-	release(block);
+	if (b_new != block) release(block);
 }
 
 
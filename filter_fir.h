@@ -26,6 +26,7 @@
 #include "Arduino.h"
 #include "AudioStream.h"
 #include "arm_math.h"
+#include "utility/memory_account.h"
 
 // Indicates that the code should just pass through the audio
 // without any filtering (as opposed to doing nothing at all)
@@ -33,7 +34,7 @@
 
 #define FIR_MAX_COEFFS 200
 
-class AudioFilterFIR : public AudioStream
+class AudioFilterFIR : public AudioStream, public AudioMemoryAccount
 {
 public:
 	AudioFilterFIR(void): AudioStream(1,inputQueueArray), coeff_p(NULL) {
@@ -0,0 +1,58 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "filter_fir_f32.h"
+
+void AudioFilterFIR_F32::update(void)
+{
+	audio_block_f32_t *block, *b_new;
+
+	block = receiveReadOnly_f32();
+	if (!block) return;
+
+	// If there's no coefficient table, give up.
+	if (coeff_p == NULL) {
+		release(block);
+		return;
+	}
+
+	// do passthru
+	if (coeff_p == FIR_F32_PASSTHRU) {
+		transmit(block);
+		release(block);
+		return;
+	}
+
+	// get a block for the FIR output
+	b_new = allocate_f32();
+	if (b_new) {
+		arm_fir_f32(&fir_inst, block->data, b_new->data, AUDIO_BLOCK_SAMPLES);
+		transmit(b_new);
+		release(b_new);
+	}
+	release(block);
+}
@@ -0,0 +1,74 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef filter_fir_f32_h_
+#define filter_fir_f32_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+// Indicates that the code should just pass through the audio
+// without any filtering (as opposed to doing nothing at all)
+#define FIR_F32_PASSTHRU ((const float *) 1)
+
+#define FIR_F32_MAX_COEFFS 200
+
+class AudioFilterFIR_F32 : public AudioStream_F32
+{
+public:
+	AudioFilterFIR_F32(void) : AudioStream_F32(0, NULL, 1, inputQueueArray_f32),
+	  coeff_p(NULL) {
+	}
+	void begin(const float *cp, int n_coeffs) {
+		coeff_p = cp;
+		// Initialize FIR instance (ARM DSP Math Library)
+		if (coeff_p && (coeff_p != FIR_F32_PASSTHRU)) {
+			if (n_coeffs < 1 || n_coeffs > FIR_F32_MAX_COEFFS) {
+				coeff_p = NULL;
+				return;
+			}
+			arm_fir_init_f32(&fir_inst, n_coeffs, (float32_t *)coeff_p,
+				&StateF32[0], AUDIO_BLOCK_SAMPLES);
+		}
+	}
+	void end(void) {
+		coeff_p = NULL;
+	}
+	virtual void update(void);
+private:
+	audio_block_f32_t *inputQueueArray_f32[1];
+
+	// pointer to current coefficients or NULL or FIR_F32_PASSTHRU
+	const float *coeff_p;
+
+	// ARM DSP Math library filter instance
+	arm_fir_instance_f32 fir_inst;
+	float32_t StateF32[AUDIO_BLOCK_SAMPLES + FIR_F32_MAX_COEFFS];
+};
+
+#endif
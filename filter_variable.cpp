@@ -27,6 +27,7 @@
 #include <Arduino.h>
 #include "filter_variable.h"
 #include "utility/dspinst.h"
+#include "utility/inplace.h"
 
 // State Variable Filter (Chamberlin) with 2X oversampling
 // http://www.musicdsp.org/showArchiveComment.php?ArchiveID=92
@@ -192,7 +193,9 @@ void AudioFilterStateVariable::update(void)
 		if (control_block) release(control_block);
 		return;
 	}
-	highpass_block = allocate();
+	// each input sample is read before the outputs are written,
+	// so the input block can become the highpass output
+	highpass_block = inplace_output(input_block, allocate);
 	if (!highpass_block) {
 		release(input_block);
 		release(lowpass_block);
@@ -214,7 +217,7 @@ void AudioFilterStateVariable::update(void)
 			 bandpass_block->data,
 			 highpass_block->data);
 	}
-	release(input_block);
+	if (input_block != highpass_block) release(input_block);
 	transmit(lowpass_block, 0);
 	release(lowpass_block);
 	transmit(bandpass_block, 1);
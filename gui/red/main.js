@@ -89,8 +89,13 @@ var RED = (function() {
 							if (wire) {
 								var parts = wire.split(":");
 								if (parts.length == 2) {
-									cpp += "AudioConnection          patchCord" + cordcount + "(";
 									var src = RED.nodes.node(n.id);
+									// floating point outputs need floating point connections
+									if (src && src._def.floatOutputs) {
+										cpp += "AudioConnection_F32      patchCord" + cordcount + "(";
+									} else {
+										cpp += "AudioConnection          patchCord" + cordcount + "(";
+									}
 									var dst = RED.nodes.node(parts[0]);
 									var src_name = make_name(src);
 									var dst_name = make_name(dst);
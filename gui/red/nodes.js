@@ -363,6 +363,7 @@ RED.nodes = (function() {
 
 		const NODE_COMMENT	= "//";
 		const NODE_AC		= "AudioConnection";
+		const NODE_AC_F32	= "AudioConnection_F32";
 
 		var parseLine = function(line) {
 
@@ -395,7 +396,7 @@ RED.nodes = (function() {
 				}
 			}
 
-			if (type == NODE_AC) {
+			if (type == NODE_AC || type == NODE_AC_F32) {
 				parts = name.match(/^([^\(]*\()([^\)]*)(.*)/);
 				if (parts && parts.length > 1) {
 					conn = $.trim(parts[2]).split(",");
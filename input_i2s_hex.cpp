@@ -27,6 +27,7 @@
 #include <Arduino.h>
 #include "input_i2s_hex.h"
 #include "output_i2s.h"
+#include "memcpy_audio.h"
 
 DMAMEM __attribute__((aligned(32))) static uint32_t i2s_rx_buffer[AUDIO_BLOCK_SAMPLES*3];
 audio_block_t * AudioInputI2SHex::block_ch1 = NULL;
@@ -93,7 +94,7 @@ void AudioInputI2SHex::isr(void)
 {
 	uint32_t daddr, offset;
 	const int16_t *src;
-	int16_t *dest1, *dest2, *dest3, *dest4, *dest5, *dest6;
+	int16_t *dest[6];
 
 	//digitalWriteFast(3, HIGH);
 	daddr = (uint32_t)(dma.TCD->DADDR);
@@ -114,20 +115,13 @@ void AudioInputI2SHex::isr(void)
 		if (offset <= AUDIO_BLOCK_SAMPLES/2) {
 			arm_dcache_delete((void*)src, sizeof(i2s_rx_buffer) / 2);
 			block_offset = offset + AUDIO_BLOCK_SAMPLES/2;
-			dest1 = &(block_ch1->data[offset]);
-			dest2 = &(block_ch2->data[offset]);
-			dest3 = &(block_ch3->data[offset]);
-			dest4 = &(block_ch4->data[offset]);
-			dest5 = &(block_ch5->data[offset]);
-			dest6 = &(block_ch6->data[offset]);
-			for (int i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
-				*dest1++ = *src++;
-				*dest3++ = *src++;
-				*dest5++ = *src++;
-				*dest2++ = *src++;
-				*dest4++ = *src++;
-				*dest6++ = *src++;
-			}
+			dest[0] = &(block_ch1->data[offset]);
+			dest[1] = &(block_ch2->data[offset]);
+			dest[2] = &(block_ch3->data[offset]);
+			dest[3] = &(block_ch4->data[offset]);
+			dest[4] = &(block_ch5->data[offset]);
+			dest[5] = &(block_ch6->data[offset]);
+			memcpy_frominterleave_pins(dest, src, 3, AUDIO_BLOCK_SAMPLES/2);
 		}
 	}
 	//digitalWriteFast(3, LOW);
@@ -27,6 +27,7 @@
 #include <Arduino.h>
 #include "input_i2s_oct.h"
 #include "output_i2s.h"
+#include "memcpy_audio.h"
 
 DMAMEM __attribute__((aligned(32))) static uint32_t i2s_rx_buffer[AUDIO_BLOCK_SAMPLES*4];
 audio_block_t * AudioInputI2SOct::block_ch1 = NULL;
@@ -83,7 +84,7 @@ void AudioInputI2SOct::isr(void)
 {
 	uint32_t daddr, offset;
 	const int16_t *src;
-	int16_t *dest1, *dest2, *dest3, *dest4, *dest5, *dest6, *dest7, *dest8;
+	int16_t *dest[8];
 
 	//digitalWriteFast(3, HIGH);
 	daddr = (uint32_t)(dma.TCD->DADDR);
@@ -104,24 +105,15 @@ void AudioInputI2SOct::isr(void)
 		if (offset <= AUDIO_BLOCK_SAMPLES/2) {
 			arm_dcache_delete((void *)src, sizeof(i2s_rx_buffer) / 2);
 			block_offset = offset + AUDIO_BLOCK_SAMPLES/2;
-			dest1 = &(block_ch1->data[offset]);
-			dest2 = &(block_ch2->data[offset]);
-			dest3 = &(block_ch3->data[offset]);
-			dest4 = &(block_ch4->data[offset]);
-			dest5 = &(block_ch5->data[offset]);
-			dest6 = &(block_ch6->data[offset]);
-			dest7 = &(block_ch7->data[offset]);
-			dest8 = &(block_ch8->data[offset]);
-			for (int i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
-				*dest1++ = *src++;
-				*dest3++ = *src++;
-				*dest5++ = *src++;
-				*dest7++ = *src++;
-				*dest2++ = *src++;
-				*dest4++ = *src++;
-				*dest6++ = *src++;
-				*dest8++ = *src++;
-			}
+			dest[0] = &(block_ch1->data[offset]);
+			dest[1] = &(block_ch2->data[offset]);
+			dest[2] = &(block_ch3->data[offset]);
+			dest[3] = &(block_ch4->data[offset]);
+			dest[4] = &(block_ch5->data[offset]);
+			dest[5] = &(block_ch6->data[offset]);
+			dest[6] = &(block_ch7->data[offset]);
+			dest[7] = &(block_ch8->data[offset]);
+			memcpy_frominterleave_pins(dest, src, 4, AUDIO_BLOCK_SAMPLES/2);
 		}
 	}
 	//digitalWriteFast(3, LOW);
@@ -28,6 +28,7 @@
 #include "input_i2s_quad.h"
 #include "output_i2s_quad.h"
 #include "output_i2s.h"
+#include "memcpy_audio.h"
 
 DMAMEM __attribute__((aligned(32))) static uint32_t i2s_rx_buffer[AUDIO_BLOCK_SAMPLES*2];
 audio_block_t * AudioInputI2SQuad::block_ch1 = NULL;
@@ -129,7 +130,7 @@ void AudioInputI2SQuad::isr(void)
 {
 	uint32_t daddr, offset;
 	const int16_t *src;
-	int16_t *dest1, *dest2, *dest3, *dest4;
+	int16_t *dest[4];
 
 	//digitalWriteFast(3, HIGH);
 	daddr = (uint32_t)(dma.TCD->DADDR);
@@ -150,16 +151,11 @@ void AudioInputI2SQuad::isr(void)
 		if (offset <= AUDIO_BLOCK_SAMPLES/2) {
 			arm_dcache_delete((void*)src, sizeof(i2s_rx_buffer) / 2);
 			block_offset = offset + AUDIO_BLOCK_SAMPLES/2;
-			dest1 = &(block_ch1->data[offset]);
-			dest2 = &(block_ch2->data[offset]);
-			dest3 = &(block_ch3->data[offset]);
-			dest4 = &(block_ch4->data[offset]);
-			for (int i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
-				*dest1++ = *src++;
-				*dest3++ = *src++;
-				*dest2++ = *src++;
-				*dest4++ = *src++;
-			}
+			dest[0] = &(block_ch1->data[offset]);
+			dest[1] = &(block_ch2->data[offset]);
+			dest[2] = &(block_ch3->data[offset]);
+			dest[3] = &(block_ch4->data[offset]);
+			memcpy_frominterleave_pins(dest, src, 2, AUDIO_BLOCK_SAMPLES/2);
 		}
 	}
 	//digitalWriteFast(3, LOW);
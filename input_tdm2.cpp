@@ -28,6 +28,7 @@
 #include <Arduino.h>
 #include "input_tdm2.h"
 #include "output_tdm2.h"
+#include "memcpy_audio.h"
 #include "utility/imxrt_hw.h"
 
 DMAMEM __attribute__((aligned(32)))
@@ -70,20 +71,6 @@ void AudioInputTDM2::begin(void)
 
 }
 
-// TODO: needs optimization...
-static void memcpy_tdm_rx(uint32_t *dest1, uint32_t *dest2, const uint32_t *src)
-{
-	uint32_t i, in1, in2;
-
-	for (i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
-		in1 = *src;
-		in2 = *(src+8);
-		src += 16;
-		*dest1++ = (in1 >> 16) | (in2 & 0xFFFF0000);
-		*dest2++ = (in1 << 16) | (in2 & 0x0000FFFF);
-	}
-}
-
 void AudioInputTDM2::isr(void)
 {
 	uint32_t daddr;
@@ -107,9 +94,8 @@ void AudioInputTDM2::isr(void)
 		arm_dcache_delete((void*)src, sizeof(tdm_rx_buffer) / 2);
 		#endif
 		for (i=0; i < 16; i += 2) {
-			uint32_t *dest1 = (uint32_t *)(block_incoming[i]->data);
-			uint32_t *dest2 = (uint32_t *)(block_incoming[i+1]->data);
-			memcpy_tdm_rx(dest1, dest2, src);
+			memcpy_tdm_rx16(block_incoming[i]->data,
+				block_incoming[i+1]->data, src, 8, AUDIO_BLOCK_SAMPLES);
 			src++;
 		}
 	}
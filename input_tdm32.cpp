@@ -0,0 +1,158 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "input_tdm32.h"
+#include "output_tdm.h"
+#include "memcpy_audio.h"
+#if defined(KINETISK) || defined(__IMXRT1062__)
+
+DMAMEM __attribute__((aligned(32)))
+static uint32_t tdm32_rx_buffer[AUDIO_BLOCK_SAMPLES*16];
+audio_block_f32_t * AudioInputTDM32::block_incoming[8] = {
+	nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr
+};
+bool AudioInputTDM32::update_responsibility = false;
+DMAChannel AudioInputTDM32::dma(false);
+
+
+void AudioInputTDM32::begin(void)
+{
+	dma.begin(true); // Allocate the DMA channel first
+
+	AudioOutputTDM::config_tdm();
+#if defined(KINETISK)
+	CORE_PIN13_CONFIG = PORT_PCR_MUX(4); // pin 13, PTC5, I2S0_RXD0
+	dma.TCD->SADDR = &I2S0_RDR0;
+	dma.TCD->SOFF = 0;
+	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+	dma.TCD->NBYTES_MLNO = 4;
+	dma.TCD->SLAST = 0;
+	dma.TCD->DADDR = tdm32_rx_buffer;
+	dma.TCD->DOFF = 4;
+	dma.TCD->CITER_ELINKNO = sizeof(tdm32_rx_buffer) / 4;
+	dma.TCD->DLASTSGA = -sizeof(tdm32_rx_buffer);
+	dma.TCD->BITER_ELINKNO = sizeof(tdm32_rx_buffer) / 4;
+	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_I2S0_RX);
+	update_responsibility = update_setup();
+	dma.enable();
+
+	I2S0_RCSR |= I2S_RCSR_RE | I2S_RCSR_BCE | I2S_RCSR_FRDE | I2S_RCSR_FR;
+	I2S0_TCSR |= I2S_TCSR_TE | I2S_TCSR_BCE; // TX clock enable, because sync'd to TX
+#elif defined(__IMXRT1062__)
+	CORE_PIN8_CONFIG  = 3;  //RX_DATA0
+	IOMUXC_SAI1_RX_DATA0_SELECT_INPUT = 2;
+	dma.TCD->SADDR = &I2S1_RDR0;
+	dma.TCD->SOFF = 0;
+	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+	dma.TCD->NBYTES_MLNO = 4;
+	dma.TCD->SLAST = 0;
+	dma.TCD->DADDR = tdm32_rx_buffer;
+	dma.TCD->DOFF = 4;
+	dma.TCD->CITER_ELINKNO = sizeof(tdm32_rx_buffer) / 4;
+	dma.TCD->DLASTSGA = -sizeof(tdm32_rx_buffer);
+	dma.TCD->BITER_ELINKNO = sizeof(tdm32_rx_buffer) / 4;
+	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SAI1_RX);
+	update_responsibility = update_setup();
+	dma.enable();
+
+	I2S1_RCSR = I2S_RCSR_RE | I2S_RCSR_BCE | I2S_RCSR_FRDE | I2S_RCSR_FR;
+#endif
+	dma.attachInterrupt(isr);
+}
+
+void AudioInputTDM32::isr(void)
+{
+	uint32_t daddr;
+	const uint32_t *src;
+	unsigned int i;
+
+	daddr = (uint32_t)(dma.TCD->DADDR);
+	dma.clearInterrupt();
+
+	if (daddr < (uint32_t)tdm32_rx_buffer + sizeof(tdm32_rx_buffer) / 2) {
+		// DMA is receiving to the first half of the buffer
+		// need to remove data from the second half
+		src = &tdm32_rx_buffer[AUDIO_BLOCK_SAMPLES*8];
+	} else {
+		// DMA is receiving to the second half of the buffer
+		// need to remove data from the first half
+		src = &tdm32_rx_buffer[0];
+	}
+	if (block_incoming[0] != nullptr) {
+		arm_dcache_delete((void*)src, sizeof(tdm32_rx_buffer) / 2);
+		for (i=0; i < 8; i++) {
+			memcpy_tdm_rx_f32(block_incoming[i]->data, src + i, 8,
+				AUDIO_BLOCK_SAMPLES);
+		}
+	}
+	if (update_responsibility) update_all();
+}
+
+
+void AudioInputTDM32::update(void)
+{
+	unsigned int i, j;
+	audio_block_f32_t *new_block[8];
+	audio_block_f32_t *out_block[8];
+
+	// allocate 8 new blocks.  If any fails, allocate none
+	for (i=0; i < 8; i++) {
+		new_block[i] = allocate_f32();
+		if (new_block[i] == nullptr) {
+			for (j=0; j < i; j++) {
+				release(new_block[j]);
+			}
+			memset(new_block, 0, sizeof(new_block));
+			break;
+		}
+	}
+	__disable_irq();
+	memcpy(out_block, block_incoming, sizeof(out_block));
+	memcpy(block_incoming, new_block, sizeof(block_incoming));
+	__enable_irq();
+	if (out_block[0] != nullptr) {
+		// if we got 1 block, all 8 are filled
+		for (i=0; i < 8; i++) {
+			transmit(out_block[i], i);
+			release(out_block[i]);
+		}
+	}
+}
+
+#else
+
+void AudioInputTDM32::begin(void)
+{
+}
+
+void AudioInputTDM32::update(void)
+{
+}
+
+#endif
@@ -38,6 +38,29 @@ void memcpy_tointerleaveL(int16_t *dst, const int16_t *srcL);
 void memcpy_tointerleaveR(int16_t *dst, const int16_t *srcR);
 void memcpy_tointerleaveQuad(int16_t *dst, const int16_t *src1, const int16_t *src2,
 	const int16_t *src3, const int16_t *src4);
+
+// memcpy_interleave.cpp: TDM slots & multi-pin I2S, "len" samples per channel
+// TDM 16 bit slots, 2 channels per 32 bit word, "stride" words per frame
+void memcpy_tdm_tx16(uint32_t *dst, const int16_t *src1, const int16_t *src2,
+	unsigned int stride, unsigned int len);
+void memcpy_tdm_rx16(int16_t *dst1, int16_t *dst2, const uint32_t *src,
+	unsigned int stride, unsigned int len);
+// TDM 24 or 32 bit slots, 1 channel per word, left justified
+void memcpy_tdm_tx32(uint32_t *dst, const int16_t *src,
+	unsigned int stride, unsigned int len);
+void memcpy_tdm_rx32(int16_t *dst, const uint32_t *src,
+	unsigned int stride, unsigned int len);
+// TDM or I2S 24 or 32 bit slots, to/from floating point -1.0 to +1.0
+void memcpy_tdm_tx_f32(uint32_t *dst, const float *src,
+	unsigned int stride, unsigned int len);
+void memcpy_tdm_rx_f32(float *dst, const uint32_t *src,
+	unsigned int stride, unsigned int len);
+// I2S with 1 to 4 data pins, each frame is all left channels then all right
+// channels, so src[0], src[2], src[4].. src[1], src[3], src[5]..
+void memcpy_tointerleave_pins(int16_t *dst, const int16_t * const *src,
+	unsigned int pins, unsigned int len);
+void memcpy_frominterleave_pins(int16_t * const *dst, const int16_t *src,
+	unsigned int pins, unsigned int len);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,214 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Interleave & deinterleave for TDM and multi-pin I2S.  The loops are
+// written so the compiler keeps every pointer in a register and uses
+// 32 bit loads (2 samples) with the Cortex-M4/M7 pack instructions.
+// On Teensy LC, dspinst.h provides plain C for the pack instructions.
+//
+// examples/HardwareTesting/InterleaveBenchmark prints the CPU cycles
+// each of these uses per audio update, compared to simple C loops.
+
+#include <Arduino.h>
+#include "memcpy_audio.h"
+#include "utility/dspinst.h"
+
+void memcpy_tdm_tx16(uint32_t *dst, const int16_t *src1, const int16_t *src2,
+	unsigned int stride, unsigned int len)
+{
+	const uint32_t *s1 = (const uint32_t *)src1;
+	const uint32_t *s2 = (const uint32_t *)src2;
+	const uint32_t *end = s1 + len / 2;
+	uint32_t in1, in2, in3, in4;
+
+	// 4 frames per loop, first channel in the upper half of each word
+	do {
+		in1 = *s1++;
+		in2 = *s2++;
+		in3 = *s1++;
+		in4 = *s2++;
+		dst[0] = pack_16b_16b(in1, in2);
+		dst[stride] = pack_16t_16t(in1, in2);
+		dst[stride*2] = pack_16b_16b(in3, in4);
+		dst[stride*3] = pack_16t_16t(in3, in4);
+		dst += stride * 4;
+	} while (s1 < end);
+}
+
+void memcpy_tdm_rx16(int16_t *dst1, int16_t *dst2, const uint32_t *src,
+	unsigned int stride, unsigned int len)
+{
+	uint32_t *d1 = (uint32_t *)dst1;
+	uint32_t *d2 = (uint32_t *)dst2;
+	uint32_t *end = d1 + len / 2;
+	uint32_t in1, in2, in3, in4;
+
+	do {
+		in1 = src[0];
+		in2 = src[stride];
+		in3 = src[stride*2];
+		in4 = src[stride*3];
+		src += stride * 4;
+		*d1++ = pack_16t_16t(in2, in1);
+		*d2++ = pack_16b_16b(in2, in1);
+		*d1++ = pack_16t_16t(in4, in3);
+		*d2++ = pack_16b_16b(in4, in3);
+	} while (d1 < end);
+}
+
+void memcpy_tdm_tx32(uint32_t *dst, const int16_t *src,
+	unsigned int stride, unsigned int len)
+{
+	const uint32_t *s = (const uint32_t *)src;
+	const uint32_t *end = s + len / 2;
+	uint32_t in1, in2;
+
+	do {
+		in1 = *s++;
+		in2 = *s++;
+		dst[0] = in1 << 16;
+		dst[stride] = in1 & 0xFFFF0000;
+		dst[stride*2] = in2 << 16;
+		dst[stride*3] = in2 & 0xFFFF0000;
+		dst += stride * 4;
+	} while (s < end);
+}
+
+void memcpy_tdm_rx32(int16_t *dst, const uint32_t *src,
+	unsigned int stride, unsigned int len)
+{
+	uint32_t *d = (uint32_t *)dst;
+	uint32_t *end = d + len / 2;
+
+	do {
+		*d++ = pack_16t_16t(src[stride], src[0]);
+		*d++ = pack_16t_16t(src[stride*3], src[stride*2]);
+		src += stride * 4;
+	} while (d < end);
+}
+
+void memcpy_tdm_tx_f32(uint32_t *dst, const float *src,
+	unsigned int stride, unsigned int len)
+{
+	const float *end = src + len;
+
+	do {
+		float n = *src++ * 2147483648.0f;
+		// largest float below 2^31, since (int32_t) of larger is undefined
+		if (n > 2147483520.0f) n = 2147483520.0f;
+		else if (n < -2147483648.0f) n = -2147483648.0f;
+		*dst = (int32_t)n;
+		dst += stride;
+	} while (src < end);
+}
+
+void memcpy_tdm_rx_f32(float *dst, const uint32_t *src,
+	unsigned int stride, unsigned int len)
+{
+	float *end = dst + len;
+
+	do {
+		*dst++ = (float)(int32_t)*src * (1.0f / 2147483648.0f);
+		src += stride;
+	} while (dst < end);
+}
+
+// With "pins" constant, each of these inlines to a loop with all
+// pointers in registers, 2 frames per iteration.
+static inline void tointerleave(int16_t *dst, const int16_t * const *src,
+	const unsigned int pins, unsigned int len) __attribute__((always_inline));
+static inline void tointerleave(int16_t *dst, const int16_t * const *src,
+	const unsigned int pins, unsigned int len)
+{
+	const uint32_t *s[8];
+	uint32_t *d = (uint32_t *)dst;
+	uint32_t in[8];
+	unsigned int i, n;
+
+	for (i=0; i < pins; i++) {
+		s[i] = (const uint32_t *)src[i*2];          // left
+		s[pins+i] = (const uint32_t *)src[i*2+1];   // right
+	}
+	for (n=0; n < len/2; n++) {
+		for (i=0; i < pins*2; i++) {
+			in[i] = *s[i]++;
+		}
+		for (i=0; i < pins*2; i += 2) {
+			*d++ = pack_16b_16b(in[i+1], in[i]);
+		}
+		for (i=0; i < pins*2; i += 2) {
+			*d++ = pack_16t_16t(in[i+1], in[i]);
+		}
+	}
+}
+
+static inline void frominterleave(int16_t * const *dst, const int16_t *src,
+	const unsigned int pins, unsigned int len) __attribute__((always_inline));
+static inline void frominterleave(int16_t * const *dst, const int16_t *src,
+	const unsigned int pins, unsigned int len)
+{
+	uint32_t *d[8];
+	const uint32_t *s = (const uint32_t *)src;
+	uint32_t in[8];
+	unsigned int i, n;
+
+	for (i=0; i < pins; i++) {
+		d[i] = (uint32_t *)dst[i*2];
+		d[pins+i] = (uint32_t *)dst[i*2+1];
+	}
+	for (n=0; n < len/2; n++) {
+		for (i=0; i < pins*2; i++) {
+			in[i] = *s++;
+		}
+		// in[0..pins-1] has frame 1, in[pins..] has frame 2
+		for (i=0; i < pins*2; i += 2) {
+			*d[i]++ = pack_16b_16b(in[pins + i/2], in[i/2]);
+			*d[i+1]++ = pack_16t_16t(in[pins + i/2], in[i/2]);
+		}
+	}
+}
+
+void memcpy_tointerleave_pins(int16_t *dst, const int16_t * const *src,
+	unsigned int pins, unsigned int len)
+{
+	switch (pins) {
+		case 1: tointerleave(dst, src, 1, len); break;
+		case 2: tointerleave(dst, src, 2, len); break;
+		case 3: tointerleave(dst, src, 3, len); break;
+		case 4: tointerleave(dst, src, 4, len); break;
+	}
+}
+
+void memcpy_frominterleave_pins(int16_t * const *dst, const int16_t *src,
+	unsigned int pins, unsigned int len)
+{
+	switch (pins) {
+		case 1: frominterleave(dst, src, 1, len); break;
+		case 2: frominterleave(dst, src, 2, len); break;
+		case 3: frominterleave(dst, src, 3, len); break;
+		case 4: frominterleave(dst, src, 4, len); break;
+	}
+}
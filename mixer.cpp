@@ -31,6 +31,11 @@
 #if defined(__ARM_ARCH_7EM__)
 #define MULTI_UNITYGAIN 65536
 
+static inline int32_t gainSample(int16_t sample, int32_t mult)
+{
+	return signed_saturate_rshift(signed_multiply_32x16b(mult, sample), 16, 0);
+}
+
 static void applyGain(int16_t *data, int32_t mult)
 {
 	uint32_t *p = (uint32_t *)data;
@@ -76,6 +81,11 @@ static void applyGainThenAdd(int16_t *data, const int16_t *in, int32_t mult)
 #elif defined(KINETISL)
 #define MULTI_UNITYGAIN 256
 
+static inline int32_t gainSample(int16_t sample, int32_t mult)
+{
+	return signed_saturate_rshift((sample * mult) >> 8, 16, 0);
+}
+
 static void applyGain(int16_t *data, int32_t mult)
 {
 	const int16_t *end = data + AUDIO_BLOCK_SAMPLES;
@@ -108,8 +118,14 @@ static void applyGainThenAdd(int16_t *dst, const int16_t *src, int32_t mult)
 void AudioMixer4::update(void)
 {
 	audio_block_t *in, *out=NULL;
-	unsigned int channel;
+	unsigned int channel, offset;
 
+	events.begin();
+	offset = events.next();
+	if (offset < AUDIO_BLOCK_SAMPLES) {
+		update_events(offset);
+		return;
+	}
 	for (channel=0; channel < 4; channel++) {
 		if (!out) {
 			out = receiveWritable(channel);
@@ -131,6 +147,53 @@ void AudioMixer4::update(void)
 	}
 }
 
+// A gain changes within this block, so mix one sample at a time, adding
+// in the same order and with the same saturation as the block functions.
+void AudioMixer4::update_events(unsigned int offset)
+{
+	audio_block_t *in[4], *out=NULL;
+	audio_event_t event;
+	unsigned int channel, i, start;
+	bool any=false;
+
+	for (channel=0; channel < 4; channel++) {
+		in[channel] = receiveReadOnly(channel);
+		if (in[channel]) any = true;
+	}
+	if (any) out = allocate();
+	if (out) {
+		memset(out->data, 0, sizeof(out->data));
+	}
+	start = 0;
+	while (1) {
+		if (out) {
+			for (channel=0; channel < 4; channel++) {
+				if (!in[channel]) continue;
+				const int16_t *src = in[channel]->data;
+				int16_t *dst = out->data;
+				int32_t mult = multiplier[channel];
+				for (i=start; i < offset; i++) {
+					int32_t val = dst[i] + gainSample(src[i], mult);
+					dst[i] = signed_saturate_rshift(val, 16, 0);
+				}
+			}
+		}
+		if (offset >= AUDIO_BLOCK_SAMPLES) break;
+		events.read(&event);
+		gain(event.channel, event.value);
+		start = offset;
+		offset = events.next();
+		if (offset < start) offset = start;
+	}
+	for (channel=0; channel < 4; channel++) {
+		if (in[channel]) release(in[channel]);
+	}
+	if (out) {
+		transmit(out);
+		release(out);
+	}
+}
+
 void AudioAmplifier::update(void)
 {
 	audio_block_t *block;
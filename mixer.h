@@ -29,6 +29,7 @@
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "utility/event_queue.h"
 
 class AudioMixer4 : public AudioStream
 {
@@ -64,6 +65,15 @@ private:
 	int16_t multiplier[4];
 	audio_block_t *inputQueueArray[4];
 #endif
+public:
+	// change gain at an exact sample, see AudioEventTime()
+	bool gain(unsigned int channel, float gain, uint32_t time) {
+		if (channel >= 4) return false;
+		return events.add(time, 0, channel, gain);
+	}
+private:
+	void update_events(unsigned int offset);
+	AudioEventQueue events;
 };
 
 class AudioAmplifier : public AudioStream
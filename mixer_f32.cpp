@@ -0,0 +1,105 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "mixer_f32.h"
+
+static void applyGain(float *data, float mult)
+{
+	float *end = data + AUDIO_BLOCK_SAMPLES;
+
+	do {
+		*data++ *= mult;
+	} while (data < end);
+}
+
+static void applyGainThenAdd(float *data, const float *in, float mult)
+{
+	float *end = data + AUDIO_BLOCK_SAMPLES;
+
+	if (mult == 1.0f) {
+		do {
+			*data++ += *in++;
+		} while (data < end);
+	} else {
+		do {
+			*data++ += *in++ * mult;
+		} while (data < end);
+	}
+}
+
+void AudioMixer4_F32::update(void)
+{
+	audio_block_f32_t *in, *out=NULL;
+	unsigned int channel;
+
+	for (channel=0; channel < 4; channel++) {
+		if (!out) {
+			out = receiveWritable_f32(channel);
+			if (out) {
+				float mult = multiplier[channel];
+				if (mult != 1.0f) applyGain(out->data, mult);
+			}
+		} else {
+			in = receiveReadOnly_f32(channel);
+			if (in) {
+				applyGainThenAdd(out->data, in->data, multiplier[channel]);
+				release(in);
+			}
+		}
+	}
+	if (out) {
+		transmit(out);
+		release(out);
+	}
+}
+
+void AudioAmplifier_F32::update(void)
+{
+	audio_block_f32_t *block;
+	float mult = multiplier;
+
+	if (mult == 0.0f) {
+		// zero gain, discard any input and transmit nothing
+		block = receiveReadOnly_f32(0);
+		if (block) release(block);
+	} else if (mult == 1.0f) {
+		// unity gain, pass input to output without any change
+		block = receiveReadOnly_f32(0);
+		if (block) {
+			transmit(block);
+			release(block);
+		}
+	} else {
+		// apply gain to signal
+		block = receiveWritable_f32(0);
+		if (block) {
+			applyGain(block->data, mult);
+			transmit(block);
+			release(block);
+		}
+	}
+}
@@ -0,0 +1,65 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef mixer_f32_h_
+#define mixer_f32_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "AudioStream_F32.h"
+
+class AudioMixer4_F32 : public AudioStream_F32
+{
+public:
+	AudioMixer4_F32(void) : AudioStream_F32(0, NULL, 4, inputQueueArray_f32) {
+		for (int i=0; i<4; i++) multiplier[i] = 1.0f;
+	}
+	virtual void update(void);
+	void gain(unsigned int channel, float gain) {
+		if (channel >= 4) return;
+		multiplier[channel] = gain;
+	}
+private:
+	float multiplier[4];
+	audio_block_f32_t *inputQueueArray_f32[4];
+};
+
+class AudioAmplifier_F32 : public AudioStream_F32
+{
+public:
+	AudioAmplifier_F32(void) : AudioStream_F32(0, NULL, 1, inputQueueArray_f32),
+	  multiplier(1.0f) {
+	}
+	virtual void update(void);
+	void gain(float n) {
+		multiplier = n;
+	}
+private:
+	float multiplier;
+	audio_block_f32_t *inputQueueArray_f32[1];
+};
+
+#endif
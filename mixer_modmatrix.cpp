@@ -0,0 +1,117 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "mixer_modmatrix.h"
+#include "utility/dspinst.h"
+
+void AudioModMatrix::audioRate(int16_t *out, audio_block_t **in,
+	const int32_t *mult, int32_t dc)
+{
+	int32_t sum[AUDIO_BLOCK_SAMPLES];
+	int i, k;
+
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		sum[i] = dc;
+	}
+	for (k=0; k < 8; k++) {
+		int32_t m = mult[k];
+		if (!in[k] || m == 0) continue;
+		const int16_t *p = in[k]->data;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			sum[i] += signed_multiply_32x16b(m, p[i]);
+		}
+	}
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		out[i] = saturate16(sum[i]);
+	}
+}
+
+void AudioModMatrix::controlRateOutput(int16_t *out, audio_block_t **in,
+	const int32_t *mult, int32_t dc, int16_t *prior)
+{
+	const unsigned int s = shift;
+	const unsigned int len = 1 << s;
+	int32_t prev = *prior;
+	unsigned int i, j;
+	int k;
+
+	for (i = len - 1; i < AUDIO_BLOCK_SAMPLES; i += len) {
+		// one weighted sum per control period...
+		int32_t sum = dc;
+		for (k=0; k < 8; k++) {
+			if (in[k] && mult[k]) {
+				sum += signed_multiply_32x16b(mult[k], in[k]->data[i]);
+			}
+		}
+		int32_t next = saturate16(sum);
+		// ...and a straight line from the previous one
+		int32_t acc = prev << 12;
+		int32_t inc = ((next - prev) << 12) >> s;
+		for (j=0; j < len; j++) {
+			acc += inc;
+			*out++ = acc >> 12;
+		}
+		prev = next;
+	}
+	*prior = prev;
+}
+
+void AudioModMatrix::update(void)
+{
+	audio_block_t *in[8], *out;
+	int i, k;
+
+	for (k=0; k < 8; k++) {
+		in[k] = receiveReadOnly(k);
+	}
+	for (i=0; i < 8; i++) {
+		const int32_t *mult = multiplier[i];
+		int32_t dc = dcoffset[i];
+		bool used = (dc != 0);
+		for (k=0; k < 8 && !used; k++) {
+			if (in[k] && mult[k]) used = true;
+		}
+		if (!used) {
+			// silent output, nothing to transmit
+			last[i] = 0;
+			continue;
+		}
+		out = allocate();
+		if (!out) continue;
+		if (shift == 0) {
+			audioRate(out->data, in, mult, dc);
+			last[i] = out->data[AUDIO_BLOCK_SAMPLES-1];
+		} else {
+			controlRateOutput(out->data, in, mult, dc, &last[i]);
+		}
+		transmit(out, i);
+		release(out);
+	}
+	for (k=0; k < 8; k++) {
+		if (in[k]) release(in[k]);
+	}
+}
@@ -0,0 +1,101 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef mixer_modmatrix_h_
+#define mixer_modmatrix_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+
+// Modulation matrix: each of the 8 outputs is a weighted sum of the 8
+// inputs plus a DC offset.  One object replaces the many multiply, mixer
+// and DC objects otherwise needed to route LFOs and envelopes to several
+// destinations.  At control rate, the sums are computed only once every
+// N samples and linearly interpolated in between.
+class AudioModMatrix : public AudioStream
+{
+public:
+	AudioModMatrix(void) : AudioStream(8, inputQueueArray), hold(false),
+	  shift(0) {
+		memset(pending, 0, sizeof(pending));
+		memset(pendingOffset, 0, sizeof(pendingOffset));
+		memset(multiplier, 0, sizeof(multiplier));
+		memset(dcoffset, 0, sizeof(dcoffset));
+		memset(last, 0, sizeof(last));
+	}
+	virtual void update(void);
+	// Set how much of an input reaches an output, -256.0 to +256.0
+	void gain(unsigned int input, unsigned int output, float level) {
+		if (input >= 8 || output >= 8) return;
+		if (level > 256.0f) level = 256.0f;
+		else if (level < -256.0f) level = -256.0f;
+		pending[output][input] = level * 65536.0f;
+		if (!hold) applyChanges();
+	}
+	// Add a constant to an output, -1.0 to +1.0
+	void offset(unsigned int output, float level) {
+		if (output >= 8) return;
+		if (level > 1.0f) level = 1.0f;
+		else if (level < -1.0f) level = -1.0f;
+		pendingOffset[output] = level * 32767.0f;
+		if (!hold) applyChanges();
+	}
+	// Changes made after holdChanges() are kept pending, then
+	// take effect together at the next update after applyChanges().
+	void holdChanges(void) {
+		hold = true;
+	}
+	void applyChanges(void) {
+		__disable_irq();
+		memcpy(multiplier, pending, sizeof(multiplier));
+		memcpy(dcoffset, pendingOffset, sizeof(dcoffset));
+		__enable_irq();
+		hold = false;
+	}
+	// Compute outputs every N samples (1 to 128, but no more than
+	// AUDIO_BLOCK_SAMPLES, rounded down to a power of 2).  1 means
+	// audio rate.
+	void controlRate(unsigned int samples) {
+		unsigned int n = 0;
+		while (n < 7 && (2u << n) <= samples
+		  && (2u << n) <= AUDIO_BLOCK_SAMPLES) n++;
+		shift = n;
+	}
+private:
+	void audioRate(int16_t *out, audio_block_t **in, const int32_t *mult, int32_t dc);
+	void controlRateOutput(int16_t *out, audio_block_t **in, const int32_t *mult,
+		int32_t dc, int16_t *prior);
+	audio_block_t *inputQueueArray[8];
+	int32_t pending[8][8];
+	int32_t pendingOffset[8];
+	int32_t multiplier[8][8];  // [output][input], 16.16 fixed point
+	int32_t dcoffset[8];
+	int16_t last[8];
+	volatile bool hold;
+	volatile uint8_t shift;
+};
+
+#endif
@@ -42,6 +42,8 @@ public:
 	void begin(void);
 	friend class AudioInputI2S;
 	friend class AudioInputPDM;
+	friend class AudioInputI2S32;
+	friend class AudioOutputI2S32;
 #if defined(__IMXRT1062__)
 	friend class AudioOutputI2SQuad;
 	friend class AudioInputI2SQuad;
@@ -0,0 +1,166 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "output_i2s32.h"
+#include "output_i2s.h"
+#include "memcpy_audio.h"
+#if defined(KINETISK) || defined(__IMXRT1062__)
+
+audio_block_f32_t * AudioOutputI2S32::block_input[2] = {
+	nullptr, nullptr
+};
+bool AudioOutputI2S32::update_responsibility = false;
+DMAChannel AudioOutputI2S32::dma(false);
+DMAMEM __attribute__((aligned(32)))
+static uint32_t i2s32_tx_buffer[AUDIO_BLOCK_SAMPLES*4];
+
+
+void AudioOutputI2S32::begin(void)
+{
+	dma.begin(true); // Allocate the DMA channel first
+
+	for (int i=0; i < 2; i++) {
+		block_input[i] = nullptr;
+	}
+	memset(i2s32_tx_buffer, 0, sizeof(i2s32_tx_buffer));
+
+	AudioOutputI2S::config_i2s();
+#if defined(KINETISK)
+	CORE_PIN22_CONFIG = PORT_PCR_MUX(6); // pin 22, PTC1, I2S0_TXD0
+
+	dma.TCD->SADDR = i2s32_tx_buffer;
+	dma.TCD->SOFF = 4;
+	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+	dma.TCD->NBYTES_MLNO = 4;
+	dma.TCD->SLAST = -sizeof(i2s32_tx_buffer);
+	dma.TCD->DADDR = &I2S0_TDR0;
+	dma.TCD->DOFF = 0;
+	dma.TCD->CITER_ELINKNO = sizeof(i2s32_tx_buffer) / 4;
+	dma.TCD->DLASTSGA = 0;
+	dma.TCD->BITER_ELINKNO = sizeof(i2s32_tx_buffer) / 4;
+	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_I2S0_TX);
+
+	update_responsibility = update_setup();
+	dma.enable();
+
+	I2S0_TCSR = I2S_TCSR_SR;
+	I2S0_TCSR = I2S_TCSR_TE | I2S_TCSR_BCE | I2S_TCSR_FRDE;
+#elif defined(__IMXRT1062__)
+	CORE_PIN7_CONFIG  = 3;  //1:TX_DATA0
+
+	dma.TCD->SADDR = i2s32_tx_buffer;
+	dma.TCD->SOFF = 4;
+	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+	dma.TCD->NBYTES_MLNO = 4;
+	dma.TCD->SLAST = -sizeof(i2s32_tx_buffer);
+	dma.TCD->DADDR = &I2S1_TDR0;
+	dma.TCD->DOFF = 0;
+	dma.TCD->CITER_ELINKNO = sizeof(i2s32_tx_buffer) / 4;
+	dma.TCD->DLASTSGA = 0;
+	dma.TCD->BITER_ELINKNO = sizeof(i2s32_tx_buffer) / 4;
+	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SAI1_TX);
+
+	update_responsibility = update_setup();
+	dma.enable();
+
+	I2S1_RCSR |= I2S_RCSR_RE | I2S_RCSR_BCE;
+	I2S1_TCSR = I2S_TCSR_TE | I2S_TCSR_BCE | I2S_TCSR_FRDE;
+#endif
+	dma.attachInterrupt(isr);
+}
+
+void AudioOutputI2S32::isr(void)
+{
+	uint32_t *dest;
+	uint32_t saddr;
+	unsigned int i, j;
+
+	saddr = (uint32_t)(dma.TCD->SADDR);
+	dma.clearInterrupt();
+	if (saddr < (uint32_t)i2s32_tx_buffer + sizeof(i2s32_tx_buffer) / 2) {
+		// DMA is transmitting the first half of the buffer
+		// so we must fill the second half
+		dest = i2s32_tx_buffer + AUDIO_BLOCK_SAMPLES*2;
+	} else {
+		// DMA is transmitting the second half of the buffer
+		// so we must fill the first half
+		dest = i2s32_tx_buffer;
+	}
+	if (update_responsibility) AudioStream::update_all();
+
+	for (i=0; i < 2; i++) {
+		if (block_input[i]) {
+			memcpy_tdm_tx_f32(dest + i, block_input[i]->data, 2,
+				AUDIO_BLOCK_SAMPLES);
+			AudioStream_F32::release(block_input[i]);
+			block_input[i] = nullptr;
+		} else {
+			for (j=i; j < AUDIO_BLOCK_SAMPLES*2; j += 2) {
+				dest[j] = 0;
+			}
+		}
+	}
+	arm_dcache_flush_delete(dest, sizeof(i2s32_tx_buffer) / 2);
+}
+
+
+void AudioOutputI2S32::update(void)
+{
+	audio_block_f32_t *prev[2];
+	unsigned int i;
+
+	__disable_irq();
+	for (i=0; i < 2; i++) {
+		prev[i] = block_input[i];
+		block_input[i] = receiveReadOnly_f32(i);
+	}
+	__enable_irq();
+	for (i=0; i < 2; i++) {
+		if (prev[i]) release(prev[i]);
+	}
+}
+
+#else
+
+void AudioOutputI2S32::begin(void)
+{
+}
+
+void AudioOutputI2S32::update(void)
+{
+	audio_block_f32_t *block;
+	unsigned int i;
+
+	for (i=0; i < 2; i++) {
+		block = receiveReadOnly_f32(i);
+		if (block) release(block);
+	}
+}
+
+#endif
@@ -107,7 +107,7 @@ void AudioOutputI2SHex::begin(void)
 void AudioOutputI2SHex::isr(void)
 {
 	uint32_t saddr;
-	const int16_t *src1, *src2, *src3, *src4, *src5, *src6;
+	const int16_t *src[6];
 	const int16_t *zeros = (const int16_t *)zerodata;
 	int16_t *dest;
 
@@ -122,26 +122,13 @@ void AudioOutputI2SHex::isr(void)
 		dest = (int16_t *)i2s_tx_buffer;
 	}
 
-	src1 = (block_ch1_1st) ? block_ch1_1st->data + ch1_offset : zeros;
-	src2 = (block_ch2_1st) ? block_ch2_1st->data + ch2_offset : zeros;
-	src3 = (block_ch3_1st) ? block_ch3_1st->data + ch3_offset : zeros;
-	src4 = (block_ch4_1st) ? block_ch4_1st->data + ch4_offset : zeros;
-	src5 = (block_ch5_1st) ? block_ch5_1st->data + ch5_offset : zeros;
-	src6 = (block_ch6_1st) ? block_ch6_1st->data + ch6_offset : zeros;
-#if 0
-	// TODO: optimized 6 channel copy...
-	memcpy_tointerleaveQuad(dest, src1, src2, src3, src4);
-#else
-	int16_t *p=dest;
-	for (int i=0; i < AUDIO_BLOCK_SAMPLES/2; i++) {
-		*p++ = *src1++;
-		*p++ = *src3++;
-		*p++ = *src5++;
-		*p++ = *src2++;
-		*p++ = *src4++;
-		*p++ = *src6++;
-	}
-#endif
+	src[0] = (block_ch1_1st) ? block_ch1_1st->data + ch1_offset : zeros;
+	src[1] = (block_ch2_1st) ? block_ch2_1st->data + ch2_offset : zeros;
+	src[2] = (block_ch3_1st) ? block_ch3_1st->data + ch3_offset : zeros;
+	src[3] = (block_ch4_1st) ? block_ch4_1st->data + ch4_offset : zeros;
+	src[4] = (block_ch5_1st) ? block_ch5_1st->data + ch5_offset : zeros;
+	src[5] = (block_ch6_1st) ? block_ch6_1st->data + ch6_offset : zeros;
+	memcpy_tointerleave_pins(dest, src, 3, AUDIO_BLOCK_SAMPLES/2);
 	arm_dcache_flush_delete(dest, sizeof(i2s_tx_buffer) / 2);
 
 	if (block_ch1_1st) {
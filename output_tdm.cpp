@@ -103,35 +103,10 @@ void AudioOutputTDM::begin(void)
 	dma.attachInterrupt(isr);
 }
 
-// TODO: needs optimization...
-static void memcpy_tdm_tx(uint32_t *dest, const uint32_t *src1, const uint32_t *src2)
-{
-	uint32_t i, in1, in2, out1, out2;
-
-	for (i=0; i < AUDIO_BLOCK_SAMPLES/4; i++) {
-
-		in1 = *src1++;
-		in2 = *src2++;
-		out1 = (in1 << 16) | (in2 & 0xFFFF);
-		out2 = (in1 & 0xFFFF0000) | (in2 >> 16);
-		*dest = out1;
-		*(dest + 8) = out2;
-
-		in1 = *src1++;
-		in2 = *src2++;
-		out1 = (in1 << 16) | (in2 & 0xFFFF);
-		out2 = (in1 & 0xFFFF0000) | (in2 >> 16);
-		*(dest + 16)= out1;
-		*(dest + 24) = out2;
-
-		dest += 32;
-	}
-}
-
 void AudioOutputTDM::isr(void)
 {
 	uint32_t *dest;
-	const uint32_t *src1, *src2;
+	const int16_t *src1, *src2;
 	uint32_t i, saddr;
 
 #if defined(KINETISK) || defined(__IMXRT1062__)
@@ -154,9 +129,9 @@ void AudioOutputTDM::isr(void)
 	#endif
 	
 	for (i=0; i < 16; i += 2) {
-		src1 = block_input[i] ? (uint32_t *)(block_input[i]->data) : zeros;
-		src2 = block_input[i+1] ? (uint32_t *)(block_input[i+1]->data) : zeros;
-		memcpy_tdm_tx(dest, src1, src2);
+		src1 = block_input[i] ? block_input[i]->data : (const int16_t *)zeros;
+		src2 = block_input[i+1] ? block_input[i+1]->data : (const int16_t *)zeros;
+		memcpy_tdm_tx16(dest, src1, src2, 8, AUDIO_BLOCK_SAMPLES);
 		dest++;
 	}
 
@@ -38,6 +38,8 @@ public:
 	virtual void update(void);
 	void begin(void);
 	friend class AudioInputTDM;
+	friend class AudioInputTDM32;
+	friend class AudioOutputTDM32;
 protected:
 	static void config_tdm(void);
 	static audio_block_t *block_input[16];
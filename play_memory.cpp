@@ -28,18 +28,101 @@
 #include "play_memory.h"
 #include "utility/dspinst.h"
 
+// Output is computed between history[MIDDLE] and history[MIDDLE+1].
+// The filter's own center is between its taps CENTER and CENTER+1.
+#define TAPS    AUDIO_PLAY_MEMORY_TAPS
+#define CENTER  (TAPS / 2 - 1)
+#define SPAN    AUDIO_PLAY_MEMORY_HISTORY
+#define MIDDLE  (SPAN / 2 - 1)
+#define PHASES  32
+#define STEP_ONE  65536
+#define STEP_MAX  (4 * STEP_ONE)
 
-void AudioPlayMemory::play(const unsigned int *data)
+// Polyphase interpolation filter: a Kaiser windowed sinc (beta = 7), cut
+// off at 0.9 of the source Nyquist frequency, in 32 phases of 12 taps.
+// Row 32 is row 0 moved by one sample, so adjacent rows can always be
+// blended.  Images of 22050 and 11025 Hz data are at least 65 dB down
+// above 1.3 times the source Nyquist frequency, and the response is
+// within 0.7 dB up to 0.7 times.  Generator script at end of file.
+static const int16_t interpolate_table[PHASES+1][TAPS] = {
+	{   125,  -487,  1187, -2117,  2943, 29476,  2943, -2117,  1187,  -487,   125,   -10},
+	{   118,  -454,  1074, -1802,  2056, 29437,  3872, -2432,  1296,  -517,   131,   -11},
+	{   110,  -419,   958, -1488,  1214, 29316,  4842, -2744,  1400,  -546,   137,   -12},
+	{   102,  -383,   841, -1179,   420, 29112,  5847, -3049,  1498,  -570,   141,   -12},
+	{    94,  -346,   723,  -876,  -324, 28831,  6884, -3345,  1588,  -592,   144,   -13},
+	{    86,  -308,   606,  -582, -1017, 28470,  7949, -3629,  1669,  -609,   146,   -13},
+	{    77,  -270,   491,  -300, -1656, 28032,  9038, -3897,  1740,  -621,   147,   -13},
+	{    69,  -233,   378,   -29, -2240, 27520, 10146, -4146,  1799,  -628,   145,   -13},
+	{    60,  -197,   269,   227, -2770, 26940, 11268, -4374,  1846,  -630,   142,   -13},
+	{    52,  -161,   164,   468, -3244, 26288, 12400, -4577,  1879,  -626,   137,   -12},
+	{    44,  -126,    64,   691, -3662, 25571, 13536, -4752,  1897,  -615,   131,   -11},
+	{    37,   -94,   -31,   898, -4026, 24796, 14671, -4896,  1899,  -598,   121,    -9},
+	{    30,   -62,  -119,  1085, -4334, 23960, 15800, -5005,  1884,  -574,   110,    -7},
+	{    24,   -33,  -201,  1254, -4589, 23072, 16917, -5077,  1851,  -543,    97,    -4},
+	{    18,    -6,  -277,  1402, -4791, 22140, 18017, -5110,  1800,  -505,    81,    -1},
+	{    12,    19,  -345,  1531, -4943, 21162, 19095, -5100,  1730,  -459,    63,     3},
+	{     7,    42,  -405,  1641, -5045, 20144, 20144, -5045,  1641,  -405,    42,     7},
+	{     3,    63,  -459,  1730, -5100, 19095, 21162, -4943,  1531,  -345,    19,    12},
+	{    -1,    81,  -505,  1800, -5110, 18017, 22140, -4791,  1402,  -277,    -6,    18},
+	{    -4,    97,  -543,  1851, -5077, 16917, 23072, -4589,  1254,  -201,   -33,    24},
+	{    -7,   110,  -574,  1884, -5005, 15800, 23960, -4334,  1085,  -119,   -62,    30},
+	{    -9,   121,  -598,  1899, -4896, 14671, 24796, -4026,   898,   -31,   -94,    37},
+	{   -11,   131,  -615,  1897, -4752, 13536, 25571, -3662,   691,    64,  -126,    44},
+	{   -12,   137,  -626,  1879, -4577, 12400, 26288, -3244,   468,   164,  -161,    52},
+	{   -13,   142,  -630,  1846, -4374, 11268, 26940, -2770,   227,   269,  -197,    60},
+	{   -13,   145,  -628,  1799, -4146, 10146, 27520, -2240,   -29,   378,  -233,    69},
+	{   -13,   147,  -621,  1740, -3897,  9038, 28032, -1656,  -300,   491,  -270,    77},
+	{   -13,   146,  -609,  1669, -3629,  7949, 28470, -1017,  -582,   606,  -308,    86},
+	{   -13,   144,  -592,  1588, -3345,  6884, 28831,  -324,  -876,   723,  -346,    94},
+	{   -12,   141,  -570,  1498, -3049,  5847, 29112,   420, -1179,   841,  -383,   102},
+	{   -12,   137,  -546,  1400, -2744,  4842, 29316,  1214, -1488,   958,  -419,   110},
+	{   -11,   131,  -517,  1296, -2432,  3872, 29437,  2056, -1802,  1074,  -454,   118},
+	{   -10,   125,  -487,  1187, -2117,  2943, 29476,  2943, -2117,  1187,  -487,   125}
+};
+
+uint32_t AudioPlayMemoryVoice::compute_step(uint8_t format, float ratio)
 {
-	uint32_t format;
+	uint32_t step;
 
-	playing = 0;
-	prior = 0;
-	format = *data++;
-	next = data;
+	switch (format & 3) {
+	  case 1: step = STEP_ONE;     break; // 44100 Hz
+	  case 2: step = STEP_ONE / 2; break; // 22050 Hz
+	  case 3: step = STEP_ONE / 4; break; // 11025 Hz
+	  default: return STEP_ONE;
+	}
+	if (ratio == 1.0f) return step;
+	if (!(ratio > 0.01f)) ratio = 0.01f;
+	if (ratio > 4.0f) ratio = 4.0f;
+	step = (uint32_t)((float)step * ratio + 0.5f);
+	if (step < 1) step = 1;
+	if (step > STEP_MAX) step = STEP_MAX;
+	return step;
+}
+
+bool AudioPlayMemoryVoice::begin(const unsigned int *data, float ratio)
+{
+	uint32_t header;
+
+	if (!valid(data)) return false;
+	header = *data++;
 	beginning = data;
-	length = format & 0xFFFFFF;
-	playing = format >> 24;
+	length = header & 0xFFFFFF;
+	format = header >> 24;
+	src_index = 0;
+	phase = 0;
+	adpcm_predict = 0;
+	adpcm_index = 0;
+	rate_step = compute_step(format, ratio);
+	// begin with the first sample at the output position
+	memset(history, 0, sizeof(history));
+	decode(history + MIDDLE, SPAN - MIDDLE);
+	return true;
+}
+
+void AudioPlayMemory::play(const unsigned int *data)
+{
+	playing = 0;
+	if (voice.begin(data, rate_ratio)) playing = 1;
 }
 
 void AudioPlayMemory::stop(void)
@@ -49,204 +132,258 @@ void AudioPlayMemory::stop(void)
 
 extern "C" {
 extern const int16_t ulaw_decode_table[256];
+extern const int16_t adpcm_step_table[89];
+extern const int8_t adpcm_index_table[16];
 };
 
-void AudioPlayMemory::update(void)
-{
-	audio_block_t *block;
-	const unsigned int *in;
-	int16_t *out;
-	uint32_t tmp32, consumed;
-	int16_t s0, s1, s2, s3, s4;
-	int i;
-
-	if (!playing) return;
-	block = allocate();
-	if (block == NULL) return;
-
-	//Serial.write('.');
+// IMA-ADPCM is stored in blocks of 128 samples.  Each block begins with
+// a word holding the decoder state (predictor in the low 16 bits, step
+// index in bits 16-22), followed by 16 words of 4 bit codes, first sample
+// in the lowest bits.  Because every block carries its own state, decoding
+// can begin at any block.
+#define ADPCM_BLOCK_SAMPLES 128
+#define ADPCM_BLOCK_WORDS   (ADPCM_BLOCK_SAMPLES / 8 + 1)
 
-	out = block->data;
-	in = next;
-	s0 = prior;
+// decode the next samples of source data, or zeros past the end
+void AudioPlayMemoryVoice::decode(int16_t *out, uint32_t count)
+{
+	const unsigned int *data = beginning;
+	uint32_t i, n, end, tmp32, code;
+	int32_t predict, index, step, diff;
 
-	switch (playing) {
-	  case 0x01: // u-law encoded, 44100 Hz
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 4) {
-			tmp32 = *in++;
-			*out++ = ulaw_decode_table[(tmp32 >> 0) & 255];
-			*out++ = ulaw_decode_table[(tmp32 >> 8) & 255];
-			*out++ = ulaw_decode_table[(tmp32 >> 16) & 255];
-			*out++ = ulaw_decode_table[(tmp32 >> 24) & 255];
+	i = src_index;
+	n = (i < length) ? length - i : 0;
+	if (n > count) n = count;
+	end = i + n;
+	switch (format & 0xC0) {
+	  case 0x00: // u-law encoded
+		while (i < end) {
+			tmp32 = data[i >> 2] >> ((i & 3) << 3);
+			*out++ = ulaw_decode_table[tmp32 & 255];
+			i++;
 		}
-		consumed = AUDIO_BLOCK_SAMPLES;
 		break;
 
-	  case 0x81: // 16 bit PCM, 44100 Hz
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 2) {
-			tmp32 = *in++;
+	  case 0x80: // 16 bit PCM
+		while (i < end) {
+			tmp32 = data[i >> 1] >> ((i & 1) << 4);
 			*out++ = (int16_t)(tmp32 & 65535);
-			*out++ = (int16_t)(tmp32 >> 16);
+			i++;
 		}
-		consumed = AUDIO_BLOCK_SAMPLES;
 		break;
 
-	  case 0x02: // u-law encoded, 22050 Hz 
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 8) {
-			tmp32 = *in++;
-			s1 = ulaw_decode_table[(tmp32 >> 0) & 255];
-			s2 = ulaw_decode_table[(tmp32 >> 8) & 255];
-			s3 = ulaw_decode_table[(tmp32 >> 16) & 255];
-			s4 = ulaw_decode_table[(tmp32 >> 24) & 255];
-			*out++ = (s0 + s1) >> 1;
-			*out++ = s1;
-			*out++ = (s1 + s2) >> 1;
-			*out++ = s2;
-			*out++ = (s2 + s3) >> 1;
-			*out++ = s3;
-			*out++ = (s3 + s4) >> 1;
-			*out++ = s4;
-			s0 = s4;
+	  case 0x40: // IMA-ADPCM
+		predict = adpcm_predict;
+		index = adpcm_index;
+		while (i < end) {
+			data = beginning + (i / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_WORDS;
+			if ((i & (ADPCM_BLOCK_SAMPLES - 1)) == 0) {
+				tmp32 = *data;
+				predict = (int16_t)(tmp32 & 65535);
+				index = (tmp32 >> 16) & 127;
+				if (index > 88) index = 88;
+			}
+			tmp32 = data[1 + ((i & (ADPCM_BLOCK_SAMPLES - 1)) >> 3)] >> ((i & 7) << 2);
+			do {
+				code = tmp32 & 15;
+				tmp32 >>= 4;
+				step = adpcm_step_table[index];
+				diff = step >> 3;
+				if (code & 4) diff += step;
+				if (code & 2) diff += step >> 1;
+				if (code & 1) diff += step >> 2;
+				if (code & 8) diff = -diff;
+				predict = signed_saturate_rshift(predict + diff, 16, 0);
+				index += adpcm_index_table[code];
+				if (index < 0) index = 0;
+				else if (index > 88) index = 88;
+				*out++ = predict;
+				i++;
+			} while ((i & 7) && i < end);
 		}
-		consumed = AUDIO_BLOCK_SAMPLES/2;
+		adpcm_predict = predict;
+		adpcm_index = index;
 		break;
+	}
+	src_index = i + (count - n);
+	for (; n < count; n++) {
+		*out++ = 0;
+	}
+}
 
-	  case 0x82: // 16 bits PCM, 22050 Hz
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 4) {
-			tmp32 = *in++;
-			s1 = (int16_t)(tmp32 & 65535);
-			s2 = (int16_t)(tmp32 >> 16);
-			*out++ = (s0 + s1) >> 1;
-			*out++ = s1;
-			*out++ = (s1 + s2) >> 1;
-			*out++ = s2;
-			s0 = s2;
-		}
-		consumed = AUDIO_BLOCK_SAMPLES/2;
-		break;
+// Interpolate count output samples, stepping through the source by
+// step (16.16 fixed point).  Only adjacent filter phases are blended,
+// so exact 2X and 4X rates use a single phase per output.
+void AudioPlayMemoryVoice::resample(int16_t *out, uint32_t count, uint32_t step)
+{
+	int16_t buf[SPAN + (AUDIO_BLOCK_SAMPLES/2) * (STEP_MAX / STEP_ONE) + 1];
+	const int16_t *x, *c;
+	uint32_t i, pos, shift, mu;
+	int32_t a, b;
+	int k;
 
-	  case 0x03: // u-law encoded, 11025 Hz
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 16) {
-			tmp32 = *in++;
-			s1 = ulaw_decode_table[(tmp32 >> 0) & 255];
-			s2 = ulaw_decode_table[(tmp32 >> 8) & 255];
-			s3 = ulaw_decode_table[(tmp32 >> 16) & 255];
-			s4 = ulaw_decode_table[(tmp32 >> 24) & 255];
-			*out++ = (s0 * 3 + s1) >> 2;
-			*out++ = (s0 + s1)     >> 1;
-			*out++ = (s0 + s1 * 3) >> 2;
-			*out++ = s1;
-			*out++ = (s1 * 3 + s2) >> 2;
-			*out++ = (s1 + s2)     >> 1;
-			*out++ = (s1 + s2 * 3) >> 2;
-			*out++ = s2;
-			*out++ = (s2 * 3 + s3) >> 2;
-			*out++ = (s2 + s3)     >> 1;
-			*out++ = (s2 + s3 * 3) >> 2;
-			*out++ = s3;
-			*out++ = (s3 * 3 + s4) >> 2;
-			*out++ = (s3 + s4)     >> 1;
-			*out++ = (s3 + s4 * 3) >> 2;
-			*out++ = s4;
-			s0 = s4;
+	pos = phase + step * count;
+	shift = pos >> 16;
+	memcpy(buf, history, sizeof(history));
+	decode(buf + SPAN, shift);
+	pos = phase;
+	if (step > STEP_ONE) {
+		decimate(out, count, step, buf);
+	} else for (i=0; i < count; i++) {
+		x = buf + (MIDDLE - CENTER) + (pos >> 16);
+		c = interpolate_table[(pos >> 11) & (PHASES - 1)];
+		a = 0;
+		for (k=0; k < TAPS; k++) {
+			a += c[k] * x[k];
 		}
-		consumed = AUDIO_BLOCK_SAMPLES/4;
-		break;
-
-	  case 0x83: // 16 bit PCM, 11025 Hz
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 8) {
-			tmp32 = *in++;
-			s1 = (int16_t)(tmp32 & 65535);
-			s2 = (int16_t)(tmp32 >> 16);
-			*out++ = (s0 * 3 + s1) >> 2;
-			*out++ = (s0 + s1)     >> 1;
-			*out++ = (s0 + s1 * 3) >> 2;
-			*out++ = s1;
-			*out++ = (s1 * 3 + s2) >> 2;
-			*out++ = (s1 + s2)     >> 1;
-			*out++ = (s1 + s2 * 3) >> 2;
-			*out++ = s2;
-			s0 = s2;
+		mu = pos & 0x7FF;
+		if (mu) {
+			c += TAPS;
+			b = 0;
+			for (k=0; k < TAPS; k++) {
+				b += c[k] * x[k];
+			}
+			a += (int32_t)(((int64_t)(b - a) * mu) >> 11);
 		}
-		consumed = AUDIO_BLOCK_SAMPLES/4;
-		break;
+		*out++ = signed_saturate_rshift(a, 16, 15);
+		pos += step;
+	}
+	memcpy(history, buf + shift, sizeof(history));
+	phase = (phase + step * count) & 0xFFFF;
+}
 
-	  default:
-		release(block);
-		playing = 0;
-		return;
+// Faster than the source rate, the filter is stretched by the step, so
+// it cuts off at 0.9 of the output's Nyquist frequency and content above
+// that can not alias.  Each coefficient is read from the table at the
+// stretched position, blending adjacent phases, and scaled by 1/step.
+// Up to SPAN (4 times TAPS) source samples contribute to each output.
+void AudioPlayMemoryVoice::decimate(int16_t *out, uint32_t count, uint32_t step,
+	const int16_t *buf)
+{
+	const int16_t *x, *c;
+	uint32_t i, pos, scale;
+	int32_t a, t, coef;
+	int k;
+
+	scale = 0xFFFFFFFFu / step;	// filter time per source sample, 16.16
+	pos = phase;
+	for (i=0; i < count; i++) {
+		x = buf + (pos >> 16);
+		// filter time from x[0] to the output position, which is
+		// between x[MIDDLE] and x[MIDDLE+1], decreasing for each tap
+		t = ((uint64_t)((MIDDLE << 16) + (pos & 0xFFFF)) * scale) >> 16;
+		a = 0;
+		for (k=0; k < SPAN; k++, t -= scale) {
+			if (t >= (CENTER + 1) << 16) continue;
+			if (t < (CENTER + 1 - TAPS) << 16) break;
+			c = interpolate_table[(t >> 11) & (PHASES - 1)] + CENTER - (t >> 16);
+			coef = c[0] + (((c[TAPS] - c[0]) * (t & 0x7FF)) >> 11);
+			a += ((coef * (int32_t)scale) >> 16) * x[k];
+		}
+		*out++ = signed_saturate_rshift(a, 16, 15);
+		pos += step;
 	}
-	prior = s0;
-	next = in;
-	if (length > consumed) {
-		length -= consumed;
+}
+
+// Fill one block of output, returning false once the clip is finished
+bool AudioPlayMemoryVoice::render(int16_t *out)
+{
+	int16_t buf[SPAN + AUDIO_BLOCK_SAMPLES];
+	uint32_t step;
+
+	step = rate_step;
+	if (step == STEP_ONE && phase == 0) {
+		// 44100 Hz data at normal speed is copied without filtering
+		memcpy(buf, history, sizeof(history));
+		decode(buf + SPAN, AUDIO_BLOCK_SAMPLES);
+		memcpy(out, buf + MIDDLE, AUDIO_BLOCK_SAMPLES * 2);
+		memcpy(history, buf + AUDIO_BLOCK_SAMPLES, sizeof(history));
 	} else {
-		playing = 0;
+		// each half is limited to (AUDIO_BLOCK_SAMPLES/2) * 4 source samples
+		resample(out, AUDIO_BLOCK_SAMPLES/2, step);
+		resample(out + AUDIO_BLOCK_SAMPLES/2, AUDIO_BLOCK_SAMPLES/2, step);
 	}
+	// finished once the last sample has passed the output position
+	return src_index < length + (SPAN - MIDDLE);
+}
+
+void AudioPlayMemory::update(void)
+{
+	audio_block_t *block;
+
+	if (!playing) return;
+	block = allocate();
+	if (block == NULL) return;
+
+	if (!voice.render(block->data)) playing = 0;
 	transmit(block);
 	release(block);
 }
 
 
-#define B2M_88200 (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT / 2.0)
 #define B2M_44100 (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT) // 97352592
 #define B2M_22050 (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT * 2.0)
 #define B2M_11025 (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT * 4.0)
 
-
-uint32_t AudioPlayMemory::positionMillis(void)
+static uint32_t samples2millis(uint8_t format, uint32_t samples)
 {
-	uint8_t p;
-	const uint8_t *n, *b;
 	uint32_t b2m;
 
-	__disable_irq();
-	p = playing;
-	n = (const uint8_t *)next;
-	b = (const uint8_t *)beginning;
-	__enable_irq();
-	switch (p) {
-	  case 0x81: // 16 bit PCM, 44100 Hz
-		b2m = B2M_88200;  break;
-	  case 0x01: // u-law encoded, 44100 Hz
-	  case 0x82: // 16 bits PCM, 22050 Hz
-		b2m = B2M_44100;  break;
-	  case 0x02: // u-law encoded, 22050 Hz
-	  case 0x83: // 16 bit PCM, 11025 Hz
-		b2m = B2M_22050;  break;
-	  case 0x03: // u-law encoded, 11025 Hz
-		b2m = B2M_11025;  break;
+	switch (format & 3) {
+	  case 1: b2m = B2M_44100;  break;
+	  case 2: b2m = B2M_22050;  break;
+	  case 3: b2m = B2M_11025;  break;
 	  default:
 		return 0;
 	}
-	if (p == 0) return 0;
-	return ((uint64_t)(n - b) * b2m) >> 32;
+	return ((uint64_t)samples * b2m) >> 32;
 }
 
-uint32_t AudioPlayMemory::lengthMillis(void)
+uint32_t AudioPlayMemoryVoice::positionMillis(void)
 {
-	uint8_t p;
-	const uint32_t *b;
-	uint32_t b2m;
+	uint32_t n;
+
+	// the output position is behind the decoding
+	n = src_index;
+	n = (n > SPAN - MIDDLE) ? n - (SPAN - MIDDLE) : 0;
+	if (n > length) n = length;
+	return samples2millis(format, n);
+}
+
+uint32_t AudioPlayMemoryVoice::lengthMillis(void)
+{
+	return samples2millis(format, length);
+}
+
+uint32_t AudioPlayMemory::positionMillis(void)
+{
+	uint32_t ms;
 
 	__disable_irq();
-	p = playing;
-	b = (const uint32_t *)beginning;
+	ms = playing ? voice.positionMillis() : 0;
 	__enable_irq();
-	switch (p) {
-	  case 0x81: // 16 bit PCM, 44100 Hz
-	  case 0x01: // u-law encoded, 44100 Hz
-		b2m = B2M_44100;  break;
-	  case 0x82: // 16 bits PCM, 22050 Hz
-	  case 0x02: // u-law encoded, 22050 Hz
-		b2m = B2M_22050;  break;
-	  case 0x83: // 16 bit PCM, 11025 Hz
-	  case 0x03: // u-law encoded, 11025 Hz
-		b2m = B2M_11025;  break;
-	  default:
-		return 0;
-	}
-	return ((uint64_t)(*(b - 1) & 0xFFFFFF) * b2m) >> 32;
+	return ms;
 }
 
+uint32_t AudioPlayMemory::lengthMillis(void)
+{
+	uint32_t ms;
+
+	__disable_irq();
+	ms = playing ? voice.lengthMillis() : 0;
+	__enable_irq();
+	return ms;
+}
 
+/*
+#! /usr/bin/python3
+import numpy as np
+T=12; P=32; fc=0.9; beta=7.0
+for p in range(P+1):
+	t=np.array([p/P-(k-(T//2-1)) for k in range(T)])
+	w=np.i0(beta*np.sqrt(np.clip(1-(t/(T/2.0))**2,0,1)))/np.i0(beta)
+	h=fc*np.sinc(fc*t)*w; h=h/h.sum()
+	r=np.round(h*32768).astype(int)
+	r[np.argmax(r)]+=32768-r.sum()
+	print("\t{" + ",".join("%6d"%v for v in r) + "}" + ("," if p<P else ""))
+*/
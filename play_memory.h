@@ -30,22 +30,60 @@
 #include "Arduino.h"
 #include "AudioStream.h"
 
+// Samples held before and after the output position, for interpolation.
+// Playing faster than the source rate, the filter is stretched up to 4 times.
+#define AUDIO_PLAY_MEMORY_TAPS 12
+#define AUDIO_PLAY_MEMORY_HISTORY (AUDIO_PLAY_MEMORY_TAPS * 4)
+
+// Decoding and resampling of one clip, shared by AudioPlayMemory
+// and AudioPlayMemoryPoly
+class AudioPlayMemoryVoice
+{
+public:
+	AudioPlayMemoryVoice(void) : length(0), format(0) { }
+	static bool valid(const unsigned int *data) {
+		uint32_t format = *data >> 24;
+		return (format & 3) != 0 && (format & 0xC0) != 0xC0;
+	}
+	bool begin(const unsigned int *data, float ratio);
+	void rate(float ratio) { rate_step = compute_step(format, ratio); }
+	bool render(int16_t *out);
+	uint32_t positionMillis(void);
+	uint32_t lengthMillis(void);
+private:
+	static uint32_t compute_step(uint8_t format, float ratio);
+	void decode(int16_t *out, uint32_t count);
+	void resample(int16_t *out, uint32_t count, uint32_t step);
+	void decimate(int16_t *out, uint32_t count, uint32_t step, const int16_t *buf);
+	const unsigned int *beginning;
+	uint32_t length;
+	uint32_t src_index;		// next sample to decode
+	volatile uint32_t rate_step;	// source samples per output, 16.16 fixed point
+	uint32_t phase;			// fraction of a source sample, 16 bits
+	int16_t history[AUDIO_PLAY_MEMORY_HISTORY];
+	int16_t adpcm_predict;
+	uint8_t adpcm_index;
+	uint8_t format;
+};
+
 class AudioPlayMemory : public AudioStream
 {
 public:
-	AudioPlayMemory(void) : AudioStream(0, NULL), playing(0) { }
+	AudioPlayMemory(void) : AudioStream(0, NULL), playing(0), rate_ratio(1.0f) { }
 	void play(const unsigned int *data);
 	void stop(void);
 	bool isPlaying(void) { return playing; }
+	void playbackRate(float ratio) {
+		rate_ratio = ratio;
+		voice.rate(ratio);
+	}
 	uint32_t positionMillis(void);
 	uint32_t lengthMillis(void);
 	virtual void update(void);
 private:
-	const unsigned int *next;
-	const unsigned int *beginning;
-	uint32_t length;
-	int16_t prior;
+	AudioPlayMemoryVoice voice;
 	volatile uint8_t playing;
+	float rate_ratio;
 };
 
 #endif
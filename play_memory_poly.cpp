@@ -0,0 +1,145 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "play_memory_poly.h"
+#include "utility/dspinst.h"
+
+// Start a clip on a free voice, or if all are busy, in place of the
+// oldest.  Returns the voice number, or -1 if the data is not valid.
+int AudioPlayMemoryPoly::play(const unsigned int *data, float gain, float pan, float pitch)
+{
+	uint32_t age, oldest = 0;
+	int i, voice = 0;
+
+	if (!AudioPlayMemoryVoice::valid(data)) return -1;
+	for (i=0; i < AUDIO_PLAY_MEMORY_POLY_VOICES; i++) {
+		if (!((active >> i) & 1)) {
+			voice = i;
+			break;
+		}
+		age = start_count - started[i];
+		if (age > oldest) {
+			oldest = age;
+			voice = i;
+		}
+	}
+	__disable_irq();
+	active &= ~(1 << voice);
+	__enable_irq();
+	voices[voice].begin(data, pitch);
+	voice_gain[voice] = gain;
+	voice_pan[voice] = pan;
+	compute_gain(voice);
+	started[voice] = start_count++;
+	__disable_irq();
+	active |= (1 << voice);
+	__enable_irq();
+	return voice;
+}
+
+void AudioPlayMemoryPoly::stop(int voice)
+{
+	if (voice < 0 || voice >= AUDIO_PLAY_MEMORY_POLY_VOICES) return;
+	__disable_irq();
+	active &= ~(1 << voice);
+	__enable_irq();
+}
+
+void AudioPlayMemoryPoly::stop(void)
+{
+	active = 0;
+}
+
+// balance style panning: centered voices play at full gain on both
+// sides, so a mix of only centered voices needs just one block
+void AudioPlayMemoryPoly::compute_gain(int voice)
+{
+	float g, p, left, right;
+
+	g = voice_gain[voice];
+	p = voice_pan[voice];
+	if (g > 3.99f) g = 3.99f;
+	else if (g < -3.99f) g = -3.99f;
+	if (p > 1.0f) p = 1.0f;
+	else if (p < -1.0f) p = -1.0f;
+	left = (p > 0.0f) ? g * (1.0f - p) : g;
+	right = (p < 0.0f) ? g * (1.0f + p) : g;
+	__disable_irq();
+	mult_left[voice] = (int32_t)(left * 16384.0f);
+	mult_right[voice] = (int32_t)(right * 16384.0f);
+	__enable_irq();
+}
+
+void AudioPlayMemoryPoly::update(void)
+{
+	audio_block_t *left, *right;
+	int16_t buf[AUDIO_BLOCK_SAMPLES];
+	uint32_t mask, done;
+	int32_t gl, gr;
+	int i, v;
+
+	mask = active;
+	if (mask == 0) return;
+	left = allocate();
+	if (left == NULL) return;
+	memset(left->data, 0, sizeof(left->data));
+	right = NULL;
+	done = 0;
+	for (v=0; v < AUDIO_PLAY_MEMORY_POLY_VOICES; v++) {
+		if (!((mask >> v) & 1)) continue;
+		if (!voices[v].render(buf)) done |= (1 << v);
+		gl = mult_left[v];
+		gr = mult_right[v];
+		if (gl != gr && right == NULL) {
+			// first panned voice, the mix becomes stereo
+			right = allocate();
+			if (right) memcpy(right->data, left->data, sizeof(left->data));
+		}
+		if (right == NULL) {
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				left->data[i] = signed_saturate_rshift(left->data[i]
+					+ ((buf[i] * gl) >> 14), 16, 0);
+			}
+		} else {
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				left->data[i] = signed_saturate_rshift(left->data[i]
+					+ ((buf[i] * gl) >> 14), 16, 0);
+				right->data[i] = signed_saturate_rshift(right->data[i]
+					+ ((buf[i] * gr) >> 14), 16, 0);
+			}
+		}
+	}
+	if (done) active &= ~done;
+	transmit(left, 0);
+	if (right) {
+		transmit(right, 1);
+		release(right);
+	} else {
+		transmit(left, 1);
+	}
+	release(left);
+}
@@ -0,0 +1,75 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef play_memory_poly_h_
+#define play_memory_poly_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "play_memory.h"
+
+#define AUDIO_PLAY_MEMORY_POLY_VOICES 16
+
+class AudioPlayMemoryPoly : public AudioStream
+{
+public:
+	AudioPlayMemoryPoly(void) : AudioStream(0, NULL), active(0), start_count(0) { }
+	int play(const unsigned int *data, float gain = 1.0f, float pan = 0.0f, float pitch = 1.0f);
+	void stop(int voice);
+	void stop(void);
+	bool isPlaying(int voice) {
+		if (voice < 0 || voice >= AUDIO_PLAY_MEMORY_POLY_VOICES) return false;
+		return (active >> voice) & 1;
+	}
+	unsigned int voicesPlaying(void) { return __builtin_popcount(active); }
+	void gain(int voice, float n) {
+		if (voice < 0 || voice >= AUDIO_PLAY_MEMORY_POLY_VOICES) return;
+		voice_gain[voice] = n;
+		compute_gain(voice);
+	}
+	void pan(int voice, float n) {
+		if (voice < 0 || voice >= AUDIO_PLAY_MEMORY_POLY_VOICES) return;
+		voice_pan[voice] = n;
+		compute_gain(voice);
+	}
+	void pitch(int voice, float ratio) {
+		if (voice < 0 || voice >= AUDIO_PLAY_MEMORY_POLY_VOICES) return;
+		voices[voice].rate(ratio);
+	}
+	virtual void update(void);
+private:
+	void compute_gain(int voice);
+	AudioPlayMemoryVoice voices[AUDIO_PLAY_MEMORY_POLY_VOICES];
+	float voice_gain[AUDIO_PLAY_MEMORY_POLY_VOICES];
+	float voice_pan[AUDIO_PLAY_MEMORY_POLY_VOICES];
+	int32_t mult_left[AUDIO_PLAY_MEMORY_POLY_VOICES];	// 16384 = unity
+	int32_t mult_right[AUDIO_PLAY_MEMORY_POLY_VOICES];
+	uint32_t started[AUDIO_PLAY_MEMORY_POLY_VOICES];	// to find the oldest voice
+	volatile uint16_t active;
+	uint32_t start_count;
+};
+
+#endif
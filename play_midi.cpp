@@ -0,0 +1,567 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "play_midi.h"
+#include "spi_interrupt.h"
+
+enum { VOICE_WAVETABLE, VOICE_WAVEFORM, VOICE_WAVEFORM_MODULATED };
+enum { VOICE_OFF, VOICE_ON, VOICE_HELD };
+
+// Play a MIDI file stored in memory, usually a const array in flash.
+bool AudioPlayMidi::play(const unsigned char *mididata, uint32_t length)
+{
+	stop();
+	data = mididata;
+	data_length = length;
+	if (!begin_song()) {
+		data = NULL;
+		return false;
+	}
+	playing = true;
+	return true;
+}
+
+// Play a MIDI file from the SD card.  Each track is read as it plays,
+// so files of any size may be used.
+bool AudioPlayMidi::play(const char *filename)
+{
+	stop();
+#if defined(HAS_KINETIS_SDHC)
+	if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStartUsingSPI();
+#else
+	AudioStartUsingSPI();
+#endif
+	__disable_irq();
+	file = SD.open(filename);
+	__enable_irq();
+	if (file) {
+		data_length = file.size();
+		file_open = true;
+		if (begin_song()) {
+			playing = true;
+			return true;
+		}
+		file_open = false;
+		file.close();
+	}
+#if defined(HAS_KINETIS_SDHC)
+	if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+#else
+	AudioStopUsingSPI();
+#endif
+	return false;
+}
+
+void AudioPlayMidi::stop(void)
+{
+	bool was_playing;
+
+	__disable_irq();
+	was_playing = playing;
+	playing = false;
+	__enable_irq();
+	// update() does nothing while not playing, so the voices and
+	// the file may be used here without blocking interrupts.  Notes
+	// it has already queued may start up to 2 blocks from now.
+	if (was_playing) release_all(AudioEventTime() + 2 * AUDIO_BLOCK_SAMPLES);
+	data = NULL;
+	__disable_irq();
+	if (file_open) {
+		file_open = false;
+		__enable_irq();
+		file.close();
+		#if defined(HAS_KINETIS_SDHC)
+			if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+		#else
+			AudioStopUsingSPI();
+		#endif
+	} else {
+		__enable_irq();
+	}
+}
+
+uint32_t AudioPlayMidi::positionMillis(void)
+{
+	return (uint64_t)now * 1000 / (uint32_t)AUDIO_SAMPLE_RATE_EXACT;
+}
+
+bool AudioPlayMidi::addVoice(AudioSynthWavetable &synth, uint8_t channel)
+{
+	return add_voice(&synth, NULL, VOICE_WAVETABLE, channel);
+}
+
+bool AudioPlayMidi::addVoice(AudioSynthWaveform &synth, AudioEffectEnvelope &envelope,
+  uint8_t channel)
+{
+	return add_voice(&synth, &envelope, VOICE_WAVEFORM, channel);
+}
+
+bool AudioPlayMidi::addVoice(AudioSynthWaveformModulated &synth,
+  AudioEffectEnvelope &envelope, uint8_t channel)
+{
+	return add_voice(&synth, &envelope, VOICE_WAVEFORM_MODULATED, channel);
+}
+
+bool AudioPlayMidi::add_voice(AudioStream *synth, AudioEffectEnvelope *envelope,
+  uint8_t kind, uint8_t channel)
+{
+	unsigned int n = num_voices;
+
+	if (n >= AUDIO_PLAY_MIDI_VOICES || channel > 16) return false;
+	voice[n].synth = synth;
+	voice[n].envelope = envelope;
+	voice[n].kind = kind;
+	voice[n].only_channel = channel;
+	voice[n].state = VOICE_OFF;
+	voice[n].started = 0;
+	// the first timed event allocates the queue, which is not allowed
+	// within update(), so add a harmless one now
+	if (envelope) envelope->noteOff(AudioEventTime());
+	if (kind == VOICE_WAVEFORM) {
+		((AudioSynthWaveform *)synth)->amplitude(0.0f, AudioEventTime());
+	}
+	__disable_irq();
+	num_voices = n + 1;
+	__enable_irq();
+	return true;
+}
+
+// Read bytes at any position, for the headers.  Tracks use read_byte().
+bool AudioPlayMidi::read_bytes(uint32_t offset, uint8_t *buf, uint32_t len)
+{
+	if (offset + len > data_length || offset + len < offset) return false;
+	if (data) {
+		memcpy(buf, data + offset, len);
+		return true;
+	}
+	if (!file.seek(offset)) return false;
+	return file.read(buf, len) == (int)len;
+}
+
+// Parse the header and find every track.  Called with playing false,
+// so update() isn't using any of this state.
+bool AudioPlayMidi::begin_song(void)
+{
+	uint8_t buf[14];
+	uint32_t offset, length;
+	unsigned int i, tracks;
+	int32_t delta;
+
+	if (!read_bytes(0, buf, 14)) return false;
+	if (memcmp(buf, "MThd", 4) != 0) return false;
+	length = (buf[4] << 24) | (buf[5] << 16) | (buf[6] << 8) | buf[7];
+	if (length < 6) return false;
+	// format (buf[8..9]) is ignored: type 0 and 1 are played the same
+	// way, and type 2 files play their patterns all at once
+	tracks = (buf[10] << 8) | buf[11];
+	division = (buf[12] << 8) | buf[13];
+	if ((division & 0x7FFF) == 0) return false;
+	if ((division & 0x8000) && (division & 0xFF) == 0) return false;
+	offset = 8 + length;
+	num_tracks = 0;
+	while (num_tracks < tracks && num_tracks < AUDIO_PLAY_MIDI_TRACKS) {
+		// chunks other than "MTrk" are skipped, as the spec requires
+		if (!read_bytes(offset, buf, 8)) break;
+		length = (buf[4] << 24) | (buf[5] << 16) | (buf[6] << 8) | buf[7];
+		offset += 8;
+		if (length > data_length - offset) length = data_length - offset;
+		if (memcmp(buf, "MTrk", 4) == 0) {
+			track_struct *t = &track[num_tracks++];
+			t->position = offset;
+			t->end = offset + length;
+			t->tick = 0;
+			t->running_status = 0;
+			t->done = false;
+			t->buffer_offset = 0;
+			t->buffer_length = 0;
+			delta = read_length(t);
+			if (delta < 0) t->done = true;
+			else t->tick = delta;
+		}
+		offset += length;
+	}
+	if (num_tracks == 0) return false;
+	now = 0;
+	tempo_tick = 0;
+	tempo_time = 0;
+	set_tempo(500000);	// 120 BPM, until the file says otherwise
+	for (i=0; i < 16; i++) {
+		volume[i] = 100;
+		bend[i] = 0;
+	}
+	sustain = 0;
+	return true;
+}
+
+// samples per tick, with 32 bits of fraction, so rounding never
+// accumulates: each event's time is computed from the last tempo change
+void AudioPlayMidi::set_tempo(uint32_t microseconds)
+{
+	double samples;
+
+	if (division & 0x8000) {
+		// SMPTE time: frames per second and ticks per frame
+		int fps = -(int8_t)(division >> 8);
+		double rate = (fps == 29) ? 29.97 : fps;
+		samples = AUDIO_SAMPLE_RATE_EXACT / (rate * (division & 0xFF));
+	} else {
+		samples = (double)microseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000000.0) / division;
+	}
+	tick_length = samples * 4294967296.0;
+}
+
+int AudioPlayMidi::read_byte(track_struct *t)
+{
+	uint32_t n;
+
+	if (t->position >= t->end) return -1;
+	if (data) return data[t->position++];
+	n = t->position - t->buffer_offset;
+	if (n >= t->buffer_length) {
+		// the tracks are in different parts of the file,
+		// so each keeps its own small buffer
+		int len = 0;
+		if (file.seek(t->position)) len = file.read(t->buffer, sizeof(t->buffer));
+		if (len <= 0) {
+			t->end = t->position;
+			return -1;
+		}
+		t->buffer_offset = t->position;
+		t->buffer_length = len;
+		n = 0;
+	}
+	t->position++;
+	return t->buffer[n];
+}
+
+// variable length quantity, up to 28 bits.  Returns -1 at the end of the track.
+int32_t AudioPlayMidi::read_length(track_struct *t)
+{
+	int32_t n = 0;
+	int i, b;
+
+	for (i=0; i < 4; i++) {
+		b = read_byte(t);
+		if (b < 0) return -1;
+		n = (n << 7) | (b & 0x7F);
+		if (!(b & 0x80)) return n;
+	}
+	return -1;
+}
+
+void AudioPlayMidi::update(void)
+{
+	track_struct *t;
+	uint32_t block_end, when;
+	uint64_t fixed;
+	unsigned int i;
+
+	// this object has no events, but it keeps AudioEventTime() current
+	events.begin();
+	if (!playing) return;
+	block_end = now + AUDIO_BLOCK_SAMPLES;
+	while (1) {
+		// the track with the earliest event, the lowest numbered if
+		// several are equal, so a tempo change in track 0 comes first
+		t = NULL;
+		for (i=0; i < num_tracks; i++) {
+			if (track[i].done) continue;
+			if (t == NULL || track[i].tick < t->tick) t = &track[i];
+		}
+		if (t == NULL) {
+			end_song();
+			break;
+		}
+		fixed = tempo_time + (uint64_t)(t->tick - tempo_tick) * tick_length;
+		when = (fixed + 0x80000000u) >> 32;
+		if (when >= block_end) break;
+		event_offset = (when > now) ? when - now : 0;
+		next_event(t);
+	}
+	now = block_end;
+}
+
+// Process one event and read the time of the following one.
+void AudioPlayMidi::next_event(track_struct *t)
+{
+	int status, data1, data2=0, type;
+	int32_t len;
+
+	status = read_byte(t);
+	if (status < 0) goto end;
+	if (status < 0x80) {
+		// running status, the first byte is data
+		data1 = status;
+		status = t->running_status;
+		if (status < 0x80) goto end;
+	} else if (status < 0xF0) {
+		t->running_status = status;
+		data1 = read_byte(t);
+	}
+	if (status < 0xF0) {
+		type = status & 0xF0;
+		if (type != 0xC0 && type != 0xD0) data2 = read_byte(t);
+		if (data1 < 0 || data2 < 0) goto end;
+		channel_message(status, data1 & 0x7F, data2 & 0x7F);
+	} else if (status == 0xFF) {
+		// meta event
+		t->running_status = 0;
+		type = read_byte(t);
+		len = read_length(t);
+		if (type < 0 || len < 0) goto end;
+		if (type == 0x2F) goto end;
+		if (type == 0x51 && len == 3) {
+			int b1 = read_byte(t);
+			int b2 = read_byte(t);
+			int b3 = read_byte(t);
+			if (b3 < 0) goto end;
+			// the time of this event becomes the new reference
+			tempo_time += (uint64_t)(t->tick - tempo_tick) * tick_length;
+			tempo_tick = t->tick;
+			if (b1 | b2 | b3) set_tempo((b1 << 16) | (b2 << 8) | b3);
+		} else {
+			t->position += len;
+		}
+	} else if (status == 0xF0 || status == 0xF7) {
+		// system exclusive, ignored
+		t->running_status = 0;
+		len = read_length(t);
+		if (len < 0) goto end;
+		t->position += len;
+	} else {
+		goto end;
+	}
+	len = read_length(t);
+	if (len < 0) goto end;
+	t->tick += len;
+	return;
+end:
+	t->done = true;
+}
+
+void AudioPlayMidi::channel_message(uint8_t status, uint8_t data1, uint8_t data2)
+{
+	uint8_t channel = status & 0x0F;
+	unsigned int i;
+
+	switch (status & 0xF0) {
+	case 0x90:
+		if (data2 > 0) {
+			if (handleNoteOn) (*handleNoteOn)(channel + 1, data1, data2);
+			note_on(channel, data1, data2);
+			break;
+		}
+		// note on with zero velocity is note off
+		// fall through
+	case 0x80:
+		if (handleNoteOff) (*handleNoteOff)(channel + 1, data1, data2);
+		note_off(channel, data1);
+		break;
+	case 0xB0:
+		if (handleControlChange) (*handleControlChange)(channel + 1, data1, data2);
+		if (data1 == 7) {
+			volume[channel] = data2;
+		} else if (data1 == 64) {
+			if (data2 >= 64) {
+				sustain |= (1 << channel);
+			} else {
+				sustain &= ~(1 << channel);
+				for (i=0; i < num_voices; i++) {
+					if (voice[i].state == VOICE_HELD && voice[i].channel == channel) {
+						release_voice(&voice[i], event_time());
+					}
+				}
+			}
+		} else if (data1 == 120 || data1 == 123) {
+			// all sound off, all notes off
+			for (i=0; i < num_voices; i++) {
+				if (voice[i].state != VOICE_OFF && voice[i].channel == channel) {
+					release_voice(&voice[i], event_time());
+				}
+			}
+		} else if (data1 == 121) {
+			// reset all controllers
+			bend[channel] = 0;
+			sustain &= ~(1 << channel);
+			pitch_bend(channel);
+		}
+		break;
+	case 0xC0:
+		if (handleProgramChange) (*handleProgramChange)(channel + 1, data1);
+		break;
+	case 0xE0:
+		bend[channel] = ((data2 << 7) | data1) - 8192;
+		if (handlePitchBend) (*handlePitchBend)(channel + 1, bend[channel]);
+		pitch_bend(channel);
+		break;
+	}
+}
+
+// pitch bend range is the General MIDI default, +/- 2 semitones
+float AudioPlayMidi::frequency(uint8_t channel, uint8_t note)
+{
+	float n = (float)note + (float)bend[channel] * (2.0f / 8192.0f);
+	return 440.0f * powf(2.0f, (n - 69.0f) * (1.0f / 12.0f));
+}
+
+bool AudioPlayMidi::voice_busy(voice_struct *v)
+{
+	if (v->kind == VOICE_WAVETABLE) {
+		return ((AudioSynthWavetable *)v->synth)->isPlaying();
+	}
+	return v->envelope->isActive();
+}
+
+// A voice is chosen in this order: the same note still sounding on
+// this channel, any silent voice, the oldest released voice, and
+// finally the oldest playing voice.
+void AudioPlayMidi::note_on(uint8_t channel, uint8_t note, uint8_t velocity)
+{
+	voice_struct *v, *idle=NULL, *released=NULL, *oldest=NULL;
+	unsigned int i, n = num_voices;
+	uint32_t time;
+	float level;
+
+	for (i=0; i < n; i++) {
+		v = &voice[i];
+		if (v->only_channel && v->only_channel != channel + 1) continue;
+		if (v->state != VOICE_OFF && v->channel == channel && v->note == note) {
+			idle = v;
+			break;
+		}
+		if (!voice_busy(v)) {
+			if (!idle) idle = v;
+		} else if (v->state == VOICE_OFF) {
+			if (!released || v->started - released->started > 0x80000000u) released = v;
+		} else {
+			if (!oldest || v->started - oldest->started > 0x80000000u) oldest = v;
+		}
+	}
+	v = idle ? idle : (released ? released : oldest);
+	if (!v) return;
+	v->channel = channel;
+	v->note = note;
+	v->state = VOICE_ON;
+	v->started = note_count++;
+	level = (float)velocity * (float)volume[channel] * (1.0f / (127.0f * 127.0f));
+	switch (v->kind) {
+	case VOICE_WAVETABLE:
+		((AudioSynthWavetable *)v->synth)->playFrequency(frequency(channel, note),
+		  (velocity * volume[channel]) / 127);
+		break;
+	case VOICE_WAVEFORM:
+		time = event_time();
+		if (!((AudioSynthWaveform *)v->synth)->frequency(frequency(channel, note), time)) {
+			((AudioSynthWaveform *)v->synth)->frequency(frequency(channel, note));
+		}
+		if (!((AudioSynthWaveform *)v->synth)->amplitude(level, time)) {
+			((AudioSynthWaveform *)v->synth)->amplitude(level);
+		}
+		if (!v->envelope->noteOn(time)) v->envelope->noteOn();
+		break;
+	case VOICE_WAVEFORM_MODULATED:
+		((AudioSynthWaveformModulated *)v->synth)->frequency(frequency(channel, note));
+		((AudioSynthWaveformModulated *)v->synth)->amplitude(level);
+		if (!v->envelope->noteOn(event_time())) v->envelope->noteOn();
+		break;
+	}
+}
+
+void AudioPlayMidi::note_off(uint8_t channel, uint8_t note)
+{
+	unsigned int i;
+
+	for (i=0; i < num_voices; i++) {
+		voice_struct *v = &voice[i];
+		if (v->state == VOICE_ON && v->channel == channel && v->note == note) {
+			if (sustain & (1 << channel)) {
+				v->state = VOICE_HELD;
+			} else {
+				release_voice(v, event_time());
+			}
+		}
+	}
+}
+
+void AudioPlayMidi::release_voice(voice_struct *v, uint32_t time)
+{
+	v->state = VOICE_OFF;
+	if (v->kind == VOICE_WAVETABLE) {
+		((AudioSynthWavetable *)v->synth)->stop();
+	} else {
+		if (!v->envelope->noteOff(time)) v->envelope->noteOff();
+	}
+}
+
+void AudioPlayMidi::release_all(uint32_t time)
+{
+	unsigned int i;
+
+	for (i=0; i < num_voices; i++) {
+		if (voice[i].state != VOICE_OFF) release_voice(&voice[i], time);
+	}
+}
+
+void AudioPlayMidi::pitch_bend(uint8_t channel)
+{
+	unsigned int i;
+
+	for (i=0; i < num_voices; i++) {
+		voice_struct *v = &voice[i];
+		if (v->state == VOICE_OFF || v->channel != channel) continue;
+		switch (v->kind) {
+		case VOICE_WAVETABLE:
+			((AudioSynthWavetable *)v->synth)->setFrequency(frequency(channel, v->note));
+			break;
+		case VOICE_WAVEFORM:
+			if (!((AudioSynthWaveform *)v->synth)->frequency(frequency(channel, v->note),
+			  event_time())) {
+				((AudioSynthWaveform *)v->synth)->frequency(frequency(channel, v->note));
+			}
+			break;
+		case VOICE_WAVEFORM_MODULATED:
+			((AudioSynthWaveformModulated *)v->synth)->frequency(frequency(channel, v->note));
+			break;
+		}
+	}
+}
+
+void AudioPlayMidi::end_song(void)
+{
+	release_all(event_time());
+	playing = false;
+	data = NULL;
+	if (file_open) {
+		file_open = false;
+		file.close();
+		#if defined(HAS_KINETIS_SDHC)
+			if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+		#else
+			AudioStopUsingSPI();
+		#endif
+	}
+}
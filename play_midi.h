@@ -0,0 +1,170 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef play_midi_h_
+#define play_midi_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "SD.h"
+#include "synth_wavetable.h"
+#include "synth_waveform.h"
+#include "effect_envelope.h"
+#include "utility/event_queue.h"
+
+// Standard MIDI File player.  Events are timed by counting samples
+// inside update(), so timing does not depend on loop() at all.  Notes
+// are played on a pool of voice objects, and any event may also be
+// given to a handler function, which runs from the audio update.
+// Waveform voices start and stop at the exact sample of each event,
+// one audio block later than the update which reads it.
+
+#define AUDIO_PLAY_MIDI_TRACKS  16
+#define AUDIO_PLAY_MIDI_VOICES  32
+#if defined(KINETISL)
+#define AUDIO_PLAY_MIDI_BUFFER  16
+#else
+#define AUDIO_PLAY_MIDI_BUFFER  64
+#endif
+
+class AudioPlayMidi : public AudioStream
+{
+public:
+	AudioPlayMidi(void) : AudioStream(0, NULL), data(NULL), playing(false),
+	  file_open(false), num_voices(0), handleNoteOn(NULL), handleNoteOff(NULL),
+	  handleControlChange(NULL), handleProgramChange(NULL), handlePitchBend(NULL) {
+		// update even when not connected to any other object
+		active = true;
+	}
+	bool play(const unsigned char *data, uint32_t length);
+	bool play(const char *filename);
+	void stop(void);
+	bool isPlaying(void) { return playing; }
+	uint32_t positionMillis(void);
+	// Voices for notes.  With a channel (1 to 16), the voice only plays
+	// notes on that channel.  Zero plays any channel.
+	bool addVoice(AudioSynthWavetable &synth, uint8_t channel = 0);
+	bool addVoice(AudioSynthWaveform &synth, AudioEffectEnvelope &envelope,
+	  uint8_t channel = 0);
+	bool addVoice(AudioSynthWaveformModulated &synth, AudioEffectEnvelope &envelope,
+	  uint8_t channel = 0);
+	void clearVoices(void) {
+		__disable_irq();
+		num_voices = 0;
+		__enable_irq();
+	}
+	// Handlers run inside the audio update, so they must be quick and
+	// must not call functions which wait for audio (or print a lot).
+	void setHandleNoteOn(void (*fptr)(uint8_t channel, uint8_t note, uint8_t velocity)) {
+		handleNoteOn = fptr;
+	}
+	void setHandleNoteOff(void (*fptr)(uint8_t channel, uint8_t note, uint8_t velocity)) {
+		handleNoteOff = fptr;
+	}
+	void setHandleControlChange(void (*fptr)(uint8_t channel, uint8_t control, uint8_t value)) {
+		handleControlChange = fptr;
+	}
+	void setHandleProgramChange(void (*fptr)(uint8_t channel, uint8_t program)) {
+		handleProgramChange = fptr;
+	}
+	void setHandlePitchChange(void (*fptr)(uint8_t channel, int pitch)) {
+		handlePitchBend = fptr;
+	}
+	// From a handler, the sample within the current audio block where
+	// the event belongs, 0 to AUDIO_BLOCK_SAMPLES-1.
+	unsigned int eventOffset(void) { return event_offset; }
+	virtual void update(void);
+private:
+	struct track_struct {
+		uint32_t position;	// offset of the next byte in the file
+		uint32_t end;
+		uint32_t tick;		// absolute time of the next event
+		uint8_t running_status;
+		bool done;
+		uint32_t buffer_offset;	// file position of buffer[0]
+		uint16_t buffer_length;
+		uint8_t buffer[AUDIO_PLAY_MIDI_BUFFER];
+	};
+	struct voice_struct {
+		AudioStream *synth;
+		AudioEffectEnvelope *envelope;
+		uint8_t kind;
+		uint8_t only_channel;	// 0 = any, or 1 to 16
+		uint8_t channel;
+		uint8_t note;
+		uint8_t state;
+		uint32_t started;
+	};
+	bool begin_song(void);
+	bool read_bytes(uint32_t offset, uint8_t *buf, uint32_t len);
+	int read_byte(track_struct *t);
+	int32_t read_length(track_struct *t);
+	void next_event(track_struct *t);
+	void channel_message(uint8_t status, uint8_t data1, uint8_t data2);
+	void set_tempo(uint32_t microseconds);
+	void note_on(uint8_t channel, uint8_t note, uint8_t velocity);
+	void note_off(uint8_t channel, uint8_t note);
+	void release_voice(voice_struct *v, uint32_t time);
+	void release_all(uint32_t time);
+	// when the current event should sound, for the voices' timed functions
+	uint32_t event_time(void) {
+		return AudioEventTime() + AUDIO_BLOCK_SAMPLES + event_offset;
+	}
+	void pitch_bend(uint8_t channel);
+	bool voice_busy(voice_struct *v);
+	bool add_voice(AudioStream *synth, AudioEffectEnvelope *envelope,
+	  uint8_t kind, uint8_t channel);
+	float frequency(uint8_t channel, uint8_t note);
+	void end_song(void);
+
+	const unsigned char *data;
+	uint32_t data_length;
+	File file;
+	volatile bool playing;
+	volatile bool file_open;
+	track_struct track[AUDIO_PLAY_MIDI_TRACKS];
+	uint8_t num_tracks;
+	uint16_t division;	// ticks per quarter note, or SMPTE format
+	uint32_t now;		// samples since the song started
+	uint32_t tempo_tick;	// tick of the last tempo change
+	uint64_t tempo_time;	// sample of the last tempo change, 32.32 fixed
+	uint64_t tick_length;	// samples per tick, 32.32 fixed
+	uint16_t event_offset;
+	voice_struct voice[AUDIO_PLAY_MIDI_VOICES];
+	volatile uint8_t num_voices;
+	uint32_t note_count;
+	uint8_t volume[16];
+	uint16_t sustain;	// bitmask of channels with the pedal down
+	int16_t bend[16];	// -8192 to +8191
+	void (*handleNoteOn)(uint8_t channel, uint8_t note, uint8_t velocity);
+	void (*handleNoteOff)(uint8_t channel, uint8_t note, uint8_t velocity);
+	void (*handleControlChange)(uint8_t channel, uint8_t control, uint8_t value);
+	void (*handleProgramChange)(uint8_t channel, uint8_t program);
+	void (*handlePitchBend)(uint8_t channel, int pitch);
+	AudioEventQueue events;
+};
+
+#endif
@@ -28,16 +28,52 @@
 #include "play_queue.h"
 #include "utility/dspinst.h"
 
-void AudioPlayQueue::setMaxBuffers(uint8_t maxb)
+void AudioPlayQueue::setMaxBuffers(unsigned int maxb)
 {
   if (maxb < 2)
     maxb = 2 ;
-  if (maxb > MAX_BUFFERS)
-    maxb = MAX_BUFFERS ;
+  if (maxb > queue_size)
+    maxb = queue_size ;
   max_buffers = maxb ;
 }
 
 
+/**
+ * Use a larger list of block pointers, allowing more than the default
+ * number (and more than 255) blocks to be queued.  The blocks themselves
+ * still come from AudioMemory().  Use only while the queue is empty.
+ */
+void AudioPlayQueue::setQueueMemory(audio_block_t **list, unsigned int count)
+{
+	if (count > 65535) count = 65535;
+	__disable_irq();
+	if (list && count >= 2) {
+		queue = list;
+		queue_size = count;
+	} else {
+		queue = queue_array;
+		queue_size = MAX_BUFFERS;
+	}
+	head = tail = 0;
+	max_buffers = queue_size;
+	__enable_irq();
+}
+
+
+/**
+ * Number of blocks waiting to be played.
+ */
+int AudioPlayQueue::queued(void)
+{
+	uint32_t h, t;
+
+	h = head;
+	t = tail;
+	if (h >= t) return h - t;
+	return max_buffers + h - t;
+}
+
+
 bool AudioPlayQueue::available(void)
 {
         if (userblock) return true;
@@ -119,6 +155,8 @@ uint32_t AudioPlayQueue::playBuffer(void)
 			queue[h] = userblock;	// block is queued for transmission
 			head = h;				// head has changed
 			userblock = NULL;		// block no longer available for filling
+			uint32_t n = queued();
+			if (n > queued_max) queued_max = n;
 		}
 	}
 	
@@ -229,6 +267,10 @@ void AudioPlayQueue::update(void)
 		transmit(block);
 		release(block);	 // we've lost interest in this block...
 		queue[t] = NULL; // ...forget it here, too
+		was_playing = true;
+	} else if (was_playing) {
+		underrun_count++; // ran dry while playing
+		was_playing = false;
 	}
 }
 
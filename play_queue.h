@@ -40,24 +40,36 @@ private:
 #endif
 public:
 	AudioPlayQueue(void) : AudioStream(0, NULL),
-	  userblock(NULL), uptr(0), head(0), tail(0), max_buffers(MAX_BUFFERS) { }
+	  queue(queue_array), userblock(NULL), uptr(0), head(0), tail(0),
+	  max_buffers(MAX_BUFFERS), queue_size(MAX_BUFFERS), queued_max(0),
+	  underrun_count(0), was_playing(false) { }
 	uint32_t play(int16_t data);
 	uint32_t play(const int16_t *data, uint32_t len);
 	bool available(void);
 	int16_t * getBuffer(void);
 	uint32_t playBuffer(void);
 	void stop(void);
-	void setMaxBuffers(uint8_t);
+	void setMaxBuffers(unsigned int);
+	void setQueueMemory(audio_block_t **list, unsigned int count);
 	//bool isPlaying(void) { return playing; }
+	int queued(void);
+	int queuedMax(void) { return queued_max; }
+	void queuedMaxReset(void) { queued_max = queued(); underrun_count = 0; }
+	uint32_t underruns(void) { return underrun_count; }
 	virtual void update(void);
 	enum behaviour_e {ORIGINAL,NON_STALLING};
 	void setBehaviour(behaviour_e behave) {behaviour = behave;}
 private:
-	audio_block_t *queue[MAX_BUFFERS];
+	audio_block_t *queue_array[MAX_BUFFERS];
+	audio_block_t **queue;
 	audio_block_t *userblock;
 	unsigned int uptr; // actually an index, NOT a pointer!
-	volatile uint8_t head, tail;
-	volatile uint8_t max_buffers;
+	volatile uint16_t head, tail;
+	volatile uint16_t max_buffers;
+	uint16_t queue_size;
+	volatile uint16_t queued_max;
+	volatile uint32_t underrun_count;
+	bool was_playing;
 	behaviour_e behaviour;
 };
 
@@ -31,22 +31,43 @@
 #include "AudioStream.h"
 #include "SD.h"
 
+// bytes read ahead into RAM by cue(), and kept from the loop start
+#if defined(__IMXRT1062__)
+#define AUDIO_PLAY_SD_RAW_PRELOAD 2048
+#elif defined(KINETISL)
+#define AUDIO_PLAY_SD_RAW_PRELOAD 256
+#else
+#define AUDIO_PLAY_SD_RAW_PRELOAD 512
+#endif
+
 class AudioPlaySdRaw : public AudioStream
 {
 public:
 	AudioPlaySdRaw(void) : AudioStream(0, NULL) { begin(); }
 	void begin(void);
 	bool play(const char *filename);
+	bool play(void);
+	bool cue(const char *filename, uint32_t sample = 0);
 	void stop(void);
+	bool seek(uint32_t sample);
+	void setLoop(uint32_t startSample, uint32_t endSample = 0);
+	void clearLoop(void);
 	bool isPlaying(void) { return playing; }
 	uint32_t positionMillis(void);
 	uint32_t lengthMillis(void);
 	virtual void update(void);
 private:
+	uint32_t read(uint8_t *data, uint32_t len);
 	File rawfile;
 	uint32_t file_size;
-	volatile uint32_t file_offset;
+	volatile uint32_t file_offset;	// playback position, in bytes
+	volatile uint32_t loop_start;
+	volatile uint32_t loop_end;	// zero when not looping
+	uint32_t preload_offset;	// file offset of preload[0]
+	uint32_t preload_length;
 	volatile bool playing;
+	volatile bool file_open;
+	uint8_t preload[AUDIO_PLAY_SD_RAW_PRELOAD];
 };
 
 #endif
@@ -45,11 +45,23 @@
 #define STATE_PAUSED			13
 #define STATE_STOP			14
 
+// bytes per sample frame, for a STATE_DIRECT or STATE_CONVERT state
+static inline uint32_t bytes_per_frame(uint8_t state_play)
+{
+	return ((state_play & 1) ? 2 : 1) * ((state_play & 2) ? 2 : 1);
+}
+
 void AudioPlaySdWav::begin(void)
 {
 	state = STATE_STOP;
 	state_play = STATE_STOP;
 	data_length = 0;
+	total_length = 0;
+	data_end = 0;
+	preload_position = 0;
+	preload_length = 0;
+	looping = false;
+	loop_wrap = false;
 	if (block_left) {
 		release(block_left);
 		block_left = NULL;
@@ -69,6 +81,68 @@ bool AudioPlaySdWav::play(const char *filename)
 		NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
 		irq = true;
 	}
+	bool ok = open(filename);
+	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+	return ok;
+}
+
+// Start playing a file prepared by cue(), or resume when paused.
+bool AudioPlaySdWav::play(void)
+{
+	bool irq = false;
+	if (NVIC_IS_ENABLED(IRQ_SOFTWARE)) {
+		NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
+		irq = true;
+	}
+	if (state == STATE_PAUSED) state = state_play;
+	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+	return isPlaying();
+}
+
+// Open a file, parse its header and read ahead from the starting sample,
+// leaving it paused.  play() then starts the sound on the very next
+// update, with no wait for the card.
+bool AudioPlaySdWav::cue(const char *filename, uint32_t sample)
+{
+	stop();
+	bool irq = false;
+	if (NVIC_IS_ENABLED(IRQ_SOFTWARE)) {
+		NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
+		irq = true;
+	}
+	if (!open(filename)) {
+		if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+		return false;
+	}
+	// without output blocks, consume() stops paused at the audio data
+	while (state >= 8 && state < STATE_PAUSED) {
+		if (read_buffer() == 0) break;
+		consume(buffer_length - buffer_offset);
+	}
+	if (state != STATE_PAUSED) {
+		wavfile.close();
+#if defined(HAS_KINETIS_SDHC)
+		if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+#else
+		AudioStopUsingSPI();
+#endif
+		state_play = STATE_STOP;
+		state = STATE_STOP;
+		if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+		return false;
+	}
+	uint32_t frame = bytes_per_frame(state_play);
+	if (sample > total_length / frame) sample = total_length / frame;
+	set_position(sample * frame);
+	preload_sectors(file_position);
+	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+	return true;
+}
+
+// Open a file, ready for update() or cue() to parse the header.
+// Called with the software interrupt disabled.
+bool AudioPlaySdWav::open(const char *filename)
+{
 #if defined(HAS_KINETIS_SDHC)
 	if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStartUsingSPI();
 #else
@@ -81,16 +155,17 @@ bool AudioPlaySdWav::play(const char *filename)
 #else
 		AudioStopUsingSPI();
 #endif
-		if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
 		return false;
 	}
 	buffer_length = 0;
 	buffer_offset = 0;
+	file_position = 0;
+	preload_length = 0;
+	loop_wrap = false;
 	state_play = STATE_STOP;
 	data_length = 20;
 	header_offset = 0;
 	state = STATE_PARSE1;
-	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
 	return true;
 }
 
@@ -119,6 +194,56 @@ void AudioPlaySdWav::stop(void)
 	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
 }
 
+// Move to any sample, once the header is parsed.  While paused, the
+// new position is read ahead, so play() still starts without delay.
+bool AudioPlaySdWav::seek(uint32_t sample)
+{
+	bool ok = false;
+	bool irq = false;
+	if (NVIC_IS_ENABLED(IRQ_SOFTWARE)) {
+		NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
+		irq = true;
+	}
+	if (state < 8 || state == STATE_PAUSED) {
+		uint32_t frame = bytes_per_frame(state_play);
+		if (sample > total_length / frame) sample = total_length / frame;
+		set_position(sample * frame);
+		if (state == STATE_PAUSED) preload_sectors(file_position);
+		ok = true;
+	}
+	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+	return ok;
+}
+
+// Loop back to startSample after playing endSample - 1, or after the
+// last sample when endSample is zero.  Applies to every file played
+// until clearLoop().
+void AudioPlaySdWav::setLoop(uint32_t startSample, uint32_t endSample)
+{
+	bool irq = false;
+	if (NVIC_IS_ENABLED(IRQ_SOFTWARE)) {
+		NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
+		irq = true;
+	}
+	loop_first = startSample;
+	loop_last = (endSample > 0) ? endSample : 0xFFFFFFFF;
+	looping = true;
+	if (state < 8 || state == STATE_PAUSED) set_end(data_end - data_length);
+	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+}
+
+void AudioPlaySdWav::clearLoop(void)
+{
+	bool irq = false;
+	if (NVIC_IS_ENABLED(IRQ_SOFTWARE)) {
+		NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
+		irq = true;
+	}
+	looping = false;
+	if (state < 8 || state == STATE_PAUSED) set_end(data_end - data_length);
+	if (irq) NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+}
+
 void AudioPlaySdWav::togglePlayPause(void) {
 	// take no action if wave header is not parsed OR
 	// state is explicitly STATE_STOP
@@ -140,6 +265,16 @@ void AudioPlaySdWav::update(void)
 	// only update if we're playing and not paused
 	if (state == STATE_STOP || state == STATE_PAUSED) return;
 
+	// keep the sectors at the loop start read ahead, once
+	// preload[] no longer holds data waiting to be played
+	if (loop_wrap) {
+		uint32_t pos = (data_start + loop_start) & ~511;
+		if ((pos != preload_position || preload_length == 0)
+		  && file_position - preload_position >= preload_length) {
+			preload_sectors(pos);
+		}
+	}
+
 	// allocate the audio blocks to transmit
 	block_left = allocate();
 	if (block_left == NULL) return;
@@ -168,19 +303,18 @@ void AudioPlaySdWav::update(void)
 	}
 
 	// we only get to this point when buffer[512] is empty
-	if (state != STATE_STOP && wavfile.available()) {
+	if (state != STATE_STOP) {
 		// we can read more data from the file...
 		readagain:
-		buffer_length = wavfile.read(buffer, 512);
-		if (buffer_length == 0) goto end;
-		buffer_offset = 0;
-		bool parsing = (state >= 8);
-		bool txok = consume(buffer_length);
+		if (read_buffer() == 0) goto end;
+		bool txok = consume(buffer_length - buffer_offset);
 		if (txok) {
 			if (state != STATE_STOP) return;
 		} else {
 			if (state != STATE_STOP) {
-				if (parsing && state < 8) goto readagain;
+				// header just parsed, or looped back to
+				// the start: more data to fill the blocks
+				if (state < 8) goto readagain;
 				else goto cleanup;
 			}
 		}
@@ -335,6 +469,14 @@ start:
 			// as required by WAV format.  abort if odd.  Code
 			// below will depend upon this and fail if not even.
 			leftover_bytes = 0;
+			total_length = data_length;
+			data_start = file_position - buffer_length + buffer_offset;
+			set_end(0);
+			if (!block_left) {
+				// parsing for cue(), wait at the first sample
+				state = STATE_PAUSED;
+				return false;
+			}
 			state = state_play;
 			if (state & 1) {
 				// if we're going to start stereo
@@ -342,7 +484,6 @@ start:
 				block_right = allocate();
 				if (!block_right) return false;
 			}
-			total_length = data_length;
 		} else {
 			state = STATE_PARSE4;
 		}
@@ -388,6 +529,7 @@ start:
 	  // playing mono at native sample rate
 	  case STATE_DIRECT_16BIT_MONO:
 		if (size > data_length) size = data_length;
+		if (size == 0) break; // nothing left after seek()
 		data_length -= size;
 		while (1) {
 			lsb = *p++;
@@ -402,11 +544,16 @@ start:
 				data_length += size;
 				buffer_offset = p - buffer;
 				if (block_right) release(block_right);
-				if (data_length == 0) state = STATE_STOP;
+				if (data_length == 0 && !loop_restart()) {
+					state = STATE_STOP;
+				}
 				return true;
 			}
 			if (size == 0) {
-				if (data_length == 0) break;
+				if (data_length == 0) {
+					if (loop_restart()) return false;
+					break;
+				}
 				return false;
 			}
 		}
@@ -421,6 +568,7 @@ start:
 	  // playing stereo at native sample rate
 	  case STATE_DIRECT_16BIT_STEREO:
 		if (size > data_length) size = data_length;
+		if (size == 0) break; // nothing left after seek()
 		data_length -= size;
 		if (leftover_bytes) {
 			block_left->data[block_offset] = header[0];
@@ -453,11 +601,16 @@ start:
 				block_right = NULL;
 				data_length += size;
 				buffer_offset = p - buffer;
-				if (data_length == 0) state = STATE_STOP;
+				if (data_length == 0 && !loop_restart()) {
+					state = STATE_STOP;
+				}
 				return true;
 			}
 			if (size == 0) {
-				if (data_length == 0) break;
+				if (data_length == 0) {
+					if (loop_restart()) return false;
+					break;
+				}
 				leftover_bytes = 0;
 				return false;
 			}
@@ -500,6 +653,86 @@ start:
 }
 
 
+// Fill buffer[] with the 512 bytes holding file_position, taken from
+// preload[] when it has them.  Reads stay aligned to the card's sectors,
+// buffer_offset skips to the wanted byte.
+uint32_t AudioPlaySdWav::read_buffer(void)
+{
+	uint32_t pos = file_position & ~511;
+	uint32_t index = pos - preload_position;
+	uint32_t n;
+
+	if (index < preload_length) {
+		n = preload_length - index;
+		if (n > 512) n = 512;
+		memcpy(buffer, preload + index, n);
+	} else {
+		if (wavfile.position() != pos) wavfile.seek(pos);
+		int r = wavfile.read(buffer, 512);
+		n = (r > 0) ? r : 0;
+	}
+	buffer_offset = file_position - pos;
+	file_position = pos + n;
+	if (n <= buffer_offset) {
+		buffer_offset = 0;
+		n = 0;
+	}
+	buffer_length = n;
+	return n;
+}
+
+// Read ahead the sectors starting with the one holding a file offset.
+void AudioPlaySdWav::preload_sectors(uint32_t position)
+{
+	position &= ~511;
+	wavfile.seek(position);
+	int n = wavfile.read(preload, sizeof(preload));
+	preload_position = position;
+	preload_length = (n > 0) ? n : 0;
+}
+
+// Continue playing from an audio data offset.  The next read_buffer()
+// fetches the new position.
+void AudioPlaySdWav::set_position(uint32_t offset)
+{
+	if (offset > total_length) offset = total_length;
+	file_position = data_start + offset;
+	buffer_length = 0;
+	buffer_offset = 0;
+	leftover_bytes = 0;
+	set_end(offset);
+}
+
+// Set where playing stops, or loops back, given the current offset.
+void AudioPlaySdWav::set_end(uint32_t offset)
+{
+	uint32_t frame = bytes_per_frame(state_play);
+	uint32_t frames = total_length / frame;
+	uint32_t end = total_length;
+
+	loop_wrap = false;
+	if (looping) {
+		uint32_t lend = (loop_last < frames) ? loop_last * frame : total_length;
+		loop_start = (loop_first < frames) ? loop_first * frame : total_length;
+		if (loop_start < lend && offset < lend) {
+			end = lend;
+			loop_wrap = true;
+		}
+	}
+	data_end = end;
+	data_length = end - offset;
+}
+
+// At the loop end, go back to the loop start.  Its sectors normally
+// wait in preload[], so this costs no card access.
+bool AudioPlaySdWav::loop_restart(void)
+{
+	if (!loop_wrap) return false;
+	set_position(loop_start);
+	return true;
+}
+
+
 /*
 00000000  52494646 66EA6903 57415645 666D7420  RIFFf.i.WAVEfmt 
 00000010  10000000 01000200 44AC0000 10B10200  ........D.......
@@ -613,9 +846,9 @@ uint32_t AudioPlaySdWav::positionMillis(void)
 {
 	uint8_t s = *(volatile uint8_t *)&state;
 	if (s >= 8 && s != STATE_PAUSED) return 0;
-	uint32_t tlength = *(volatile uint32_t *)&total_length;
+	uint32_t dend = *(volatile uint32_t *)&data_end;
 	uint32_t dlength = *(volatile uint32_t *)&data_length;
-	uint32_t offset = tlength - dlength;
+	uint32_t offset = dend - dlength;
 	uint32_t b2m = *(volatile uint32_t *)&bytes2millis;
 	return ((uint64_t)offset * b2m) >> 32;
 }
@@ -31,14 +31,26 @@
 #include "AudioStream.h"
 #include "SD.h"
 
+// bytes read ahead into RAM by cue(), and kept from the loop start
+#if defined(KINETISL)
+#define AUDIO_PLAY_SD_WAV_PRELOAD 512
+#else
+#define AUDIO_PLAY_SD_WAV_PRELOAD 1024
+#endif
+
 class AudioPlaySdWav : public AudioStream
 {
 public:
 	AudioPlaySdWav(void) : AudioStream(0, NULL), block_left(NULL), block_right(NULL) { begin(); }
 	void begin(void);
 	bool play(const char *filename);
+	bool play(void);
+	bool cue(const char *filename, uint32_t sample = 0);
 	void togglePlayPause(void);
 	void stop(void);
+	bool seek(uint32_t sample);
+	void setLoop(uint32_t startSample, uint32_t endSample = 0);
+	void clearLoop(void);
 	bool isPlaying(void);
 	bool isPaused(void);
 	bool isStopped(void);
@@ -47,11 +59,23 @@ public:
 	virtual void update(void);
 private:
 	File wavfile;
+	bool open(const char *filename);
 	bool consume(uint32_t size);
 	bool parse_format(void);
+	uint32_t read_buffer(void);
+	void preload_sectors(uint32_t position);
+	void set_position(uint32_t offset);
+	void set_end(uint32_t offset);
+	bool loop_restart(void);
 	uint32_t header[10];		// temporary storage of wav header data
 	uint32_t data_length;		// number of bytes remaining in current section
 	uint32_t total_length;		// number of audio data bytes in file
+	uint32_t data_start;		// file offset of the first audio data byte
+	uint32_t data_end;		// audio data offset where playing stops or loops
+	uint32_t file_position;		// file offset of the next data wanted in buffer
+	uint32_t loop_first;		// loop points in samples, as given to setLoop()
+	uint32_t loop_last;
+	uint32_t loop_start;		// loop start as audio data offset
 	uint32_t bytes2millis;
 	audio_block_t *block_left;
 	audio_block_t *block_right;
@@ -59,10 +83,15 @@ private:
 	uint8_t buffer[512];		// buffer one block of data
 	uint16_t buffer_offset;		// where we're at consuming "buffer"
 	uint16_t buffer_length;		// how much data is in "buffer" (512 until last read)
+	uint8_t preload[AUDIO_PLAY_SD_WAV_PRELOAD]; // data read ahead, 512 byte aligned
+	uint32_t preload_position;	// file offset of preload[0]
+	uint16_t preload_length;
 	uint8_t header_offset;		// number of bytes in header[]
 	uint8_t state;
 	uint8_t state_play;
 	uint8_t leftover_bytes;
+	bool looping;			// setLoop() is in effect
+	bool loop_wrap;			// data_end is the loop end
 };
 
 #endif
@@ -33,13 +33,43 @@
 void AudioPlaySerialflashRaw::begin(void)
 {
 	playing = false;
+	file_open = false;
+	mapped = NULL;
 	file_offset = 0;
 	file_size = 0;
+	loop_start = 0;
+	loop_end = 0;
+	preload_offset = 0;
+	preload_length = 0;
 }
 
 
 bool AudioPlaySerialflashRaw::play(const char *filename)
 {
+	if (!cue(filename)) return false;
+	return play();
+}
+
+bool AudioPlaySerialflashRaw::play(const void *data, uint32_t length)
+{
+	if (!cue(data, length)) return false;
+	return play();
+}
+
+// Start playing the file opened by cue().  The first blocks come
+// from preload[], so sound begins on the very next update.
+bool AudioPlaySerialflashRaw::play(void)
+{
+	if (!file_open) return false;
+	playing = true;
+	return true;
+}
+
+// Open a file and read ahead from the starting sample, without playing.
+bool AudioPlaySerialflashRaw::cue(const char *filename, uint32_t sample)
+{
+	int n;
+
 	stop();
 	AudioStartUsingSPI();
 	rawfile = SerialFlash.open(filename);
@@ -49,25 +79,80 @@ bool AudioPlaySerialflashRaw::play(const char *filename)
 		return false;
 	}
 	file_size = rawfile.size();
-	file_offset = 0;
+	file_offset = sample * 2;
+	if (file_offset > file_size) file_offset = file_size & ~1;
+	if (file_offset > 0) rawfile.seek(file_offset);
+	n = rawfile.read(preload, sizeof(preload));
+	preload_offset = file_offset;
+	preload_length = (n > 0) ? n : 0;
 	//Serial.println("able to open file");
-	playing = true;
+	file_open = true;
+	return true;
+}
+
+// Get ready to play raw data which the processor can read directly,
+// like Teensy 4.1 QSPI flash or PSRAM mapped by FlexSPI, or program
+// flash.  Each block is then a single copy from memory, without flash
+// commands, SPI bus sharing or preload[].
+bool AudioPlaySerialflashRaw::cue(const void *data, uint32_t length, uint32_t sample)
+{
+	stop();
+	if (data == NULL) return false;
+	mapped = (const uint8_t *)data;
+	file_size = length & ~1;
+	file_offset = sample * 2;
+	if (file_offset > file_size) file_offset = file_size;
+	preload_offset = 0;
+	preload_length = 0;
+	file_open = true;
 	return true;
 }
 
 void AudioPlaySerialflashRaw::stop(void)
 {
 	__disable_irq();
-	if (playing) {
+	if (file_open) {
 		playing = false;
+		file_open = false;
 		__enable_irq();
-		rawfile.close();
-		AudioStopUsingSPI();
+		if (mapped) {
+			mapped = NULL;
+		} else {
+			rawfile.close();
+			AudioStopUsingSPI();
+		}
 	} else {
 		__enable_irq();
 	}
 }
 
+// Move to any sample.  update() does the actual file seek.
+bool AudioPlaySerialflashRaw::seek(uint32_t sample)
+{
+	uint32_t offset = sample * 2;
+
+	if (!file_open) return false;
+	if (offset > file_size) offset = file_size & ~1;
+	file_offset = offset;
+	return true;
+}
+
+// Loop back to startSample after playing endSample - 1, or after the
+// last sample when endSample is zero.  Applies to every file played
+// until clearLoop().
+void AudioPlaySerialflashRaw::setLoop(uint32_t startSample, uint32_t endSample)
+{
+	__disable_irq();
+	loop_start = startSample * 2;
+	loop_end = (endSample > 0) ? endSample * 2 : 0xFFFFFFFE;
+	__enable_irq();
+}
+
+void AudioPlaySerialflashRaw::clearLoop(void)
+{
+	loop_end = 0;
+}
+
 
 void AudioPlaySerialflashRaw::update(void)
 {
@@ -81,23 +166,73 @@ void AudioPlaySerialflashRaw::update(void)
 	block = allocate();
 	if (block == NULL) return;
 
-	if (rawfile.available()) {
+	n = read((uint8_t *)block->data, AUDIO_BLOCK_SAMPLES*2);
+	if (n > 0) {
 		// we can read more data from the file...
-		n = rawfile.read(block->data, AUDIO_BLOCK_SAMPLES*2);
-		file_offset += n;
 		for (i=n/2; i < AUDIO_BLOCK_SAMPLES; i++) {
 			block->data[i] = 0;
 		}
 		transmit(block);
 	} else {
-		rawfile.close();
-		AudioStopUsingSPI();
+		if (mapped) {
+			mapped = NULL;
+		} else {
+			rawfile.close();
+			AudioStopUsingSPI();
+		}
 		playing = false;
+		file_open = false;
 		//Serial.println("Finished playing sample");		//TODO
 	}
 	release(block);
 }
 
+// Read from the playback position, wrapping at the loop end.  Data in
+// preload[] is used without accessing the flash chip.  While preload[] isn't
+// holding data yet to be played, it's filled from the loop start, so
+// wrapping around never waits for a read.
+uint32_t AudioPlaySerialflashRaw::read(uint8_t *data, uint32_t len)
+{
+	uint32_t offset, end, index, count, n;
+	int r;
+
+	uint32_t lend = loop_end;
+	if (lend > file_size) lend = file_size;
+	bool loop = (loop_start < lend);
+	offset = file_offset;
+	if (loop && !mapped && preload_offset != loop_start
+	  && offset - preload_offset >= preload_length) {
+		rawfile.seek(loop_start);
+		r = rawfile.read(preload, sizeof(preload));
+		preload_offset = loop_start;
+		preload_length = (r > 0) ? r : 0;
+	}
+	count = 0;
+	while (count < len) {
+		if (loop && offset == lend) offset = loop_start;
+		end = (loop && offset < lend) ? lend : file_size;
+		if (offset >= end) break;
+		n = end - offset;
+		if (n > len - count) n = len - count;
+		index = offset - preload_offset;
+		if (mapped) {
+			memcpy(data + count, mapped + offset, n);
+		} else if (index < preload_length) {
+			if (n > preload_length - index) n = preload_length - index;
+			memcpy(data + count, preload + index, n);
+		} else {
+			if (rawfile.position() != offset) rawfile.seek(offset);
+			r = rawfile.read(data + count, n);
+			if (r <= 0) break;
+			n = r;
+		}
+		offset += n;
+		count += n;
+	}
+	file_offset = offset;
+	return count;
+}
+
 #define B2M (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT / 2.0) // 97352592
 
 uint32_t AudioPlaySerialflashRaw::positionMillis(void)
@@ -32,22 +32,44 @@
 #include <AudioStream.h>
 #include <SerialFlash.h>
 
+// bytes read ahead into RAM by cue(), and kept from the loop start
+#if defined(KINETISL)
+#define AUDIO_PLAY_SERIALFLASH_RAW_PRELOAD 256
+#else
+#define AUDIO_PLAY_SERIALFLASH_RAW_PRELOAD 512
+#endif
+
 class AudioPlaySerialflashRaw : public AudioStream
 {
 public:
 	AudioPlaySerialflashRaw(void) : AudioStream(0, NULL) { begin(); }
 	void begin(void);
 	bool play(const char *filename);
+	bool play(const void *data, uint32_t length);
+	bool play(void);
+	bool cue(const char *filename, uint32_t sample = 0);
+	bool cue(const void *data, uint32_t length, uint32_t sample = 0);
 	void stop(void);
+	bool seek(uint32_t sample);
+	void setLoop(uint32_t startSample, uint32_t endSample = 0);
+	void clearLoop(void);
 	bool isPlaying(void) { return playing; }
 	uint32_t positionMillis(void);
 	uint32_t lengthMillis(void);
 	virtual void update(void);
 private:
+	uint32_t read(uint8_t *data, uint32_t len);
 	SerialFlashFile rawfile;
+	const uint8_t *mapped;		// memory mapped data, or NULL for rawfile
 	uint32_t file_size;
-	volatile uint32_t file_offset;
+	volatile uint32_t file_offset;	// playback position, in bytes
+	volatile uint32_t loop_start;
+	volatile uint32_t loop_end;	// zero when not looping
+	uint32_t preload_offset;	// file offset of preload[0]
+	uint32_t preload_length;
 	volatile bool playing;
+	volatile bool file_open;
+	uint8_t preload[AUDIO_PLAY_SERIALFLASH_RAW_PRELOAD];
 };
 
 #endif
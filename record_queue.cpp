@@ -65,6 +65,7 @@ int16_t * AudioRecordQueue::readBuffer(void)
 	if (++t >= max_buffers) t = 0;
 	userblock = queue[t];
 	tail = t;
+	uptr = 0;
 	return userblock->data;
 }
 
@@ -75,6 +76,64 @@ void AudioRecordQueue::freeBuffer(void)
 	userblock = NULL;
 }
 
+/**
+ * Copy up to len samples into data, from as many queued blocks as needed.
+ * A partly read block is kept, and the next read continues from it.
+ * \return number of samples copied, less than len if the queue ran empty
+ */
+uint32_t AudioRecordQueue::read(int16_t *data, uint32_t len)
+{
+	uint32_t count = 0;
+
+	while (count < len) {
+		if (!userblock && !readBuffer()) break;
+		uint32_t n = AUDIO_BLOCK_SAMPLES - uptr;
+		if (n > len - count) n = len - count;
+		memcpy(data + count, userblock->data + uptr, n * sizeof(int16_t));
+		uptr += n;
+		count += n;
+		if (uptr >= AUDIO_BLOCK_SAMPLES) freeBuffer();
+	}
+	return count;
+}
+
+/**
+ * Limit the queue to fewer blocks than its memory can hold.
+ * Use only while not recording (before begin or after end).
+ */
+void AudioRecordQueue::setMaxBuffers(unsigned int maxb)
+{
+	if (maxb < 2) maxb = 2;
+	if (maxb > queue_size) maxb = queue_size;
+	clear();
+	__disable_irq();
+	head = tail = 0;
+	max_buffers = maxb;
+	__enable_irq();
+}
+
+/**
+ * Use a larger list of block pointers, allowing more than the default
+ * number (and more than 255) blocks to be queued.  The blocks themselves
+ * still come from AudioMemory().  Use only while not recording.
+ */
+void AudioRecordQueue::setQueueMemory(audio_block_t **list, unsigned int count)
+{
+	if (count > 65535) count = 65535;
+	clear();
+	__disable_irq();
+	if (list && count >= 2) {
+		queue = list;
+		queue_size = count;
+	} else {
+		queue = queue_array;
+		queue_size = MAX_BUFFERS;
+	}
+	head = tail = 0;
+	max_buffers = queue_size;
+	__enable_irq();
+}
+
 void AudioRecordQueue::update(void)
 {
 	audio_block_t *block;
@@ -90,9 +149,12 @@ void AudioRecordQueue::update(void)
 	if (h >= max_buffers) h = 0;
 	if (h == tail) {
 		release(block);
+		drop_count++;
 	} else {
 		queue[h] = block;
 		head = h;
+		uint32_t n = (h >= tail) ? h - tail : max_buffers + h - tail;
+		if (n > available_max) available_max = n;
 	}
 }
 
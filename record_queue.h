@@ -34,30 +34,46 @@ class AudioRecordQueue : public AudioStream
 {
 private:
 #if defined(__IMXRT1062__) || defined(__MK66FX1M0__) || defined(__MK64FX512__)
-	static const int max_buffers = 209;
+	static const unsigned int MAX_BUFFERS = 209;
 #else
-	static const int max_buffers = 53;
+	static const unsigned int MAX_BUFFERS = 53;
 #endif
 public:
 	AudioRecordQueue(void) : AudioStream(1, inputQueueArray),
-		userblock(NULL), head(0), tail(0), enabled(0) { }
+		queue(queue_array), userblock(NULL), uptr(0), head(0), tail(0),
+		max_buffers(MAX_BUFFERS), queue_size(MAX_BUFFERS), enabled(0), available_max(0), drop_count(0) { }
 	void begin(void) {
 		clear();
+		available_max = 0;
+		drop_count = 0;
 		enabled = 1;
 	}
 	int available(void);
 	void clear(void);
 	int16_t * readBuffer(void);
 	void freeBuffer(void);
+	uint32_t read(int16_t *data, uint32_t len);
 	void end(void) {
 		enabled = 0;
 	}
+	void setMaxBuffers(unsigned int maxb);
+	void setQueueMemory(audio_block_t **list, unsigned int count);
+	int availableMax(void) { return available_max; }
+	void availableMaxReset(void) { available_max = available(); }
+	uint32_t dropped(void) { return drop_count; }
 	virtual void update(void);
 private:
 	audio_block_t *inputQueueArray[1];
-	audio_block_t * volatile queue[max_buffers];
+	audio_block_t * volatile queue_array[MAX_BUFFERS];
+	audio_block_t * volatile *queue;
 	audio_block_t *userblock;
-	volatile uint8_t head, tail, enabled;
+	unsigned int uptr; // samples already read from userblock
+	volatile uint16_t head, tail;
+	volatile uint16_t max_buffers;
+	uint16_t queue_size;
+	volatile uint8_t enabled;
+	volatile uint16_t available_max;
+	volatile uint32_t drop_count;
 };
 
 #endif
@@ -0,0 +1,274 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "record_sd_wav.h"
+#include "spi_interrupt.h"
+
+// The data chunk starts at byte 512, so every write to the card covers
+// whole sectors.  A JUNK chunk, which all WAV readers skip, fills the gap.
+#define HEADER_SIZE 512
+#define MAX_DATA_BYTES (0xFFFFFFFFu - HEADER_SIZE)
+
+static inline void put16(uint8_t *p, uint32_t n)
+{
+	p[0] = n;
+	p[1] = n >> 8;
+}
+
+static inline void put32(uint8_t *p, uint32_t n)
+{
+	p[0] = n;
+	p[1] = n >> 8;
+	p[2] = n >> 16;
+	p[3] = n >> 24;
+}
+
+static inline void start_spi(void)
+{
+#if defined(HAS_KINETIS_SDHC)
+	if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStartUsingSPI();
+#else
+	AudioStartUsingSPI();
+#endif
+}
+
+static inline void stop_spi(void)
+{
+#if defined(HAS_KINETIS_SDHC)
+	if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+#else
+	AudioStopUsingSPI();
+#endif
+}
+
+bool AudioRecordSdWav::begin(const char *filename, unsigned int channels, uint32_t preallocateSeconds)
+{
+	uint32_t n;
+
+	end();
+	if (channels < 1) channels = 1;
+	if (channels > AUDIO_RECORD_SD_WAV_CHANNELS) channels = AUDIO_RECORD_SD_WAV_CHANNELS;
+	num_channels = channels;
+	if (user_ring) {
+		ring = user_ring;
+		ring_malloc = false;
+		n = user_ring_bytes / 2;
+	} else {
+		ring = (int16_t *)malloc(AUDIO_RECORD_SD_WAV_RING);
+		if (ring == NULL) return false;
+		ring_malloc = true;
+		n = AUDIO_RECORD_SD_WAV_RING / 2;
+	}
+	// a small buffer still works, with smaller (but still whole sector) writes
+	chunk_samples = AUDIO_RECORD_SD_WAV_CHUNK / 2;
+	while (n < chunk_samples * 2 && chunk_samples > 256) chunk_samples >>= 1;
+	ring_size = n - (n % chunk_samples);
+	if (ring_size < chunk_samples * 2) {
+		if (ring_malloc) free(ring);
+		ring = NULL;
+		return false;
+	}
+	start_spi();
+	SD.remove(filename);
+#if defined(SD_FAT_VERSION)
+	wavfile = SD.sdfs.open(filename, O_WRITE | O_CREAT | O_TRUNC);
+#else
+	wavfile = SD.open(filename, FILE_WRITE);
+#endif
+	if (!wavfile) {
+		stop_spi();
+		if (ring_malloc) free(ring);
+		ring = NULL;
+		return false;
+	}
+#if defined(SD_FAT_VERSION)
+	if (preallocateSeconds > 0) {
+		// contiguous clusters let the card write without FAT updates
+		uint64_t len = (uint64_t)preallocateSeconds * (uint32_t)(AUDIO_SAMPLE_RATE_EXACT + 0.5f)
+			* 2 * channels + HEADER_SIZE;
+		if (len > 0xFFFFFFFFu) len = 0xFFFFFFFFu;
+		wavfile.preAllocate(len); // if not possible, recording still works
+	}
+#endif
+	data_bytes = 0;
+	write_error = false;
+	write_header();
+	head = 0;
+	tail = 0;
+	ring_max = 0;
+	drop_count = 0;
+	write_max = 0;
+	file_open = true;
+	recording = true;
+	return true;
+}
+
+void AudioRecordSdWav::end(void)
+{
+	uint32_t h, t, n, limit;
+
+	if (!file_open) return;
+	recording = false; // update() adds nothing more to the ring
+	service();
+	// Usually less than one chunk remains, which never wraps.  But if
+	// service() stopped at the 4 GB limit, up to the whole ring remains,
+	// so write it in 2 pieces, and only as much as the file can hold.
+	h = head;
+	t = tail;
+	limit = (MAX_DATA_BYTES / 2) / num_channels * num_channels;
+	while (t != h && !write_error) {
+		if (data_bytes / 2 >= limit) break;
+		n = ((h > t) ? h : ring_size) - t;
+		if (n > limit - data_bytes / 2) n = limit - data_bytes / 2;
+		write_chunk(ring + t, n);
+		t += n;
+		if (t >= ring_size) t = 0;
+	}
+	tail = h;
+#if defined(SD_FAT_VERSION)
+	wavfile.truncate(); // give back preallocated space beyond the audio
+#endif
+	wavfile.seek(0);
+	write_header();
+	wavfile.close();
+	file_open = false;
+	stop_spi();
+	if (ring_malloc) free(ring);
+	ring = NULL;
+}
+
+void AudioRecordSdWav::service(void)
+{
+	uint32_t h, t, used;
+
+	if (!file_open || write_error) return;
+	t = tail;
+	while (1) {
+		h = head;
+		used = (h >= t) ? h - t : ring_size + h - t;
+		if (used < chunk_samples) break;
+		if (chunk_samples * 2 > MAX_DATA_BYTES - data_bytes) {
+			recording = false; // WAV files can not exceed 4 GB
+			break;
+		}
+		write_chunk(ring + t, chunk_samples);
+		if (write_error) break;
+		t += chunk_samples;
+		if (t >= ring_size) t = 0;
+		tail = t;
+	}
+}
+
+void AudioRecordSdWav::write_chunk(const int16_t *data, uint32_t samples)
+{
+	uint32_t usec, n;
+
+	usec = micros();
+	n = wavfile.write((const uint8_t *)data, samples * 2);
+	usec = micros() - usec;
+	if (usec > write_max) write_max = usec;
+	data_bytes += n;
+	if (n != samples * 2) {
+		// card full or removed
+		write_error = true;
+		recording = false;
+	}
+}
+
+void AudioRecordSdWav::write_header(void)
+{
+	uint8_t h[HEADER_SIZE];
+	uint32_t fmtlen, junk;
+
+	memset(h, 0, sizeof(h));
+	// more than 2 channels needs WAVE_FORMAT_EXTENSIBLE
+	fmtlen = (num_channels > 2) ? 40 : 16;
+	memcpy(h, "RIFF", 4);
+	put32(h + 4, HEADER_SIZE - 8 + data_bytes);
+	memcpy(h + 8, "WAVEfmt ", 8);
+	put32(h + 16, fmtlen);
+	put16(h + 20, (num_channels > 2) ? 0xFFFE : 1);
+	put16(h + 22, num_channels);
+	put32(h + 24, (uint32_t)(AUDIO_SAMPLE_RATE_EXACT + 0.5f));
+	put32(h + 28, (uint32_t)(AUDIO_SAMPLE_RATE_EXACT + 0.5f) * 2 * num_channels);
+	put16(h + 32, 2 * num_channels);
+	put16(h + 34, 16);
+	if (fmtlen == 40) {
+		static const uint8_t pcm_guid[16] = {0x01, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+		put16(h + 36, 22);
+		put16(h + 38, 16);
+		put32(h + 40, 0); // no speaker positions assigned
+		memcpy(h + 44, pcm_guid, 16);
+	}
+	junk = 20 + fmtlen;
+	memcpy(h + junk, "JUNK", 4);
+	put32(h + junk + 4, HEADER_SIZE - 8 - (junk + 8));
+	memcpy(h + HEADER_SIZE - 8, "data", 4);
+	put32(h + HEADER_SIZE - 4, data_bytes);
+	wavfile.write(h, HEADER_SIZE);
+}
+
+void AudioRecordSdWav::update(void)
+{
+	audio_block_t *block[AUDIO_RECORD_SD_WAV_CHANNELS];
+	uint32_t ch, i, h, t, used, need;
+
+	for (ch=0; ch < AUDIO_RECORD_SD_WAV_CHANNELS; ch++) {
+		block[ch] = receiveReadOnly(ch);
+	}
+	if (recording) {
+		need = num_channels * AUDIO_BLOCK_SAMPLES;
+		h = head;
+		t = tail;
+		used = (h >= t) ? h - t : ring_size + h - t;
+		if (ring_size - used <= need) {
+			// the card has stalled longer than the ring can hold
+			drop_count++;
+		} else {
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				for (ch=0; ch < num_channels; ch++) {
+					ring[h] = block[ch] ? block[ch]->data[i] : 0;
+					if (++h >= ring_size) h = 0;
+				}
+			}
+			head = h;
+			used += need;
+			if (used > ring_max) ring_max = used;
+		}
+	}
+	for (ch=0; ch < AUDIO_RECORD_SD_WAV_CHANNELS; ch++) {
+		if (block[ch]) release(block[ch]);
+	}
+}
+
+#define B2M (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT / 2.0) // 97352592
+
+uint32_t AudioRecordSdWav::lengthMillis(void)
+{
+	return (((uint64_t)data_bytes * B2M) >> 32) / num_channels;
+}
@@ -0,0 +1,99 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef record_sd_wav_h_
+#define record_sd_wav_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "SD.h"
+
+#define AUDIO_RECORD_SD_WAV_CHANNELS 8
+
+// SD cards are fastest when written in large, sector aligned pieces.
+// The RAM ring holds several of these chunks, so a card which stalls
+// for housekeeping (often 100+ ms) does not lose audio.
+#if defined(__IMXRT1062__)
+#define AUDIO_RECORD_SD_WAV_CHUNK  8192
+#define AUDIO_RECORD_SD_WAV_RING   98304
+#else
+#define AUDIO_RECORD_SD_WAV_CHUNK  2048
+#define AUDIO_RECORD_SD_WAV_RING   16384
+#endif
+
+class AudioRecordSdWav : public AudioStream
+{
+public:
+	AudioRecordSdWav(void) : AudioStream(AUDIO_RECORD_SD_WAV_CHANNELS, inputQueueArray),
+	  ring(NULL), ring_malloc(false), user_ring(NULL), user_ring_bytes(0),
+	  ring_size(0), head(0), tail(0), ring_max(0), drop_count(0),
+	  data_bytes(0), write_max(0), num_channels(1), recording(false),
+	  file_open(false), write_error(false) { }
+	bool begin(const char *filename, unsigned int channels = 1, uint32_t preallocateSeconds = 0);
+	void end(void);
+	void service(void);
+	void setBuffer(void *buffer, uint32_t bytes) {
+		if (file_open) return;
+		user_ring = (int16_t *)buffer;
+		user_ring_bytes = bytes;
+	}
+	bool isRecording(void) { return recording; }
+	bool isError(void) { return write_error; }
+	uint32_t lengthMillis(void);
+	uint32_t dropped(void) { return drop_count; }
+	uint32_t writeMicrosMax(void) { return write_max; }
+	void writeMicrosMaxReset(void) { write_max = 0; }
+	uint32_t bufferUsedMax(void) { return ring_max * 2; }
+	uint32_t bufferSize(void) { return ring_size * 2; }
+	virtual void update(void);
+private:
+	void write_chunk(const int16_t *data, uint32_t samples);
+	void write_header(void);
+	audio_block_t *inputQueueArray[AUDIO_RECORD_SD_WAV_CHANNELS];
+#if defined(SD_FAT_VERSION)
+	FsFile wavfile;
+#else
+	File wavfile;
+#endif
+	int16_t *ring;
+	bool ring_malloc;
+	int16_t *user_ring;
+	uint32_t user_ring_bytes;
+	uint32_t ring_size;		// ring length in samples, a multiple of chunk_samples
+	uint32_t chunk_samples;
+	volatile uint32_t head;		// written by update()
+	volatile uint32_t tail;		// written by service()
+	volatile uint32_t ring_max;
+	volatile uint32_t drop_count;
+	uint32_t data_bytes;
+	uint32_t write_max;
+	uint8_t num_channels;
+	volatile bool recording;
+	bool file_open;
+	bool write_error;
+};
+
+#endif
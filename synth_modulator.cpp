@@ -0,0 +1,329 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_modulator.h"
+
+enum {
+	TARGET_SVF_FREQUENCY,
+	TARGET_SVF_RESONANCE,
+	TARGET_LADDER_FREQUENCY,
+	TARGET_LADDER_RESONANCE,
+	TARGET_WAVEFORM_FREQUENCY,
+	TARGET_WAVEFORM_AMPLITUDE,
+	TARGET_WAVEMOD_FREQUENCY,
+	TARGET_WAVEMOD_AMPLITUDE,
+	TARGET_MIXER_GAIN,
+	TARGET_AMPLIFIER_GAIN
+};
+
+bool AudioModulator::addTarget(AudioStream *obj, uint8_t kind, uint8_t channel,
+	float base, float depth)
+{
+	bool ok = false;
+
+	__disable_irq();
+	if (num_targets < AUDIO_MODULATION_TARGETS) {
+		target[num_targets].obj = obj;
+		target[num_targets].kind = kind;
+		target[num_targets].channel = channel;
+		target[num_targets].base = base;
+		target[num_targets].depth = depth;
+		num_targets = num_targets + 1;
+		ok = true;
+	}
+	__enable_irq();
+	return ok;
+}
+
+bool AudioModulator::modulate(AudioFilterStateVariable &f,
+	AudioModulationParameter p, float base, float depth)
+{
+	if (p == MODULATE_FREQUENCY) {
+		return addTarget(&f, TARGET_SVF_FREQUENCY, 0, base, depth);
+	} else if (p == MODULATE_RESONANCE) {
+		return addTarget(&f, TARGET_SVF_RESONANCE, 0, base, depth);
+	}
+	return false;
+}
+
+bool AudioModulator::modulate(AudioFilterLadder &f,
+	AudioModulationParameter p, float base, float depth)
+{
+	if (p == MODULATE_FREQUENCY) {
+		return addTarget(&f, TARGET_LADDER_FREQUENCY, 0, base, depth);
+	} else if (p == MODULATE_RESONANCE) {
+		return addTarget(&f, TARGET_LADDER_RESONANCE, 0, base, depth);
+	}
+	return false;
+}
+
+bool AudioModulator::modulate(AudioSynthWaveform &w,
+	AudioModulationParameter p, float base, float depth)
+{
+	if (p == MODULATE_FREQUENCY) {
+		return addTarget(&w, TARGET_WAVEFORM_FREQUENCY, 0, base, depth);
+	} else if (p == MODULATE_AMPLITUDE) {
+		return addTarget(&w, TARGET_WAVEFORM_AMPLITUDE, 0, base, depth);
+	}
+	return false;
+}
+
+bool AudioModulator::modulate(AudioSynthWaveformModulated &w,
+	AudioModulationParameter p, float base, float depth)
+{
+	if (p == MODULATE_FREQUENCY) {
+		return addTarget(&w, TARGET_WAVEMOD_FREQUENCY, 0, base, depth);
+	} else if (p == MODULATE_AMPLITUDE) {
+		return addTarget(&w, TARGET_WAVEMOD_AMPLITUDE, 0, base, depth);
+	}
+	return false;
+}
+
+bool AudioModulator::modulate(AudioMixer4 &m, unsigned int channel,
+	float base, float depth)
+{
+	if (channel >= 4) return false;
+	return addTarget(&m, TARGET_MIXER_GAIN, channel, base, depth);
+}
+
+bool AudioModulator::modulate(AudioAmplifier &a, float base, float depth)
+{
+	return addTarget(&a, TARGET_AMPLIFIER_GAIN, 0, base, depth);
+}
+
+// Runs inside the audio update, so the other objects' setting
+// functions may be called directly, without AudioNoInterrupts().
+void AudioModulator::apply(float v)
+{
+	unsigned int i, n = num_targets;
+
+	for (i=0; i < n; i++) {
+		const struct target_struct *t = &target[i];
+		float lin = t->base + v * t->depth;
+		switch (t->kind) {
+		  case TARGET_SVF_FREQUENCY:
+			((AudioFilterStateVariable *)t->obj)->frequency(
+				t->base * exp2f(v * t->depth));
+			break;
+		  case TARGET_SVF_RESONANCE:
+			((AudioFilterStateVariable *)t->obj)->resonance(lin);
+			break;
+		  case TARGET_LADDER_FREQUENCY:
+			((AudioFilterLadder *)t->obj)->frequency(
+				t->base * exp2f(v * t->depth));
+			break;
+		  case TARGET_LADDER_RESONANCE:
+			((AudioFilterLadder *)t->obj)->resonance(lin);
+			break;
+		  case TARGET_WAVEFORM_FREQUENCY:
+			((AudioSynthWaveform *)t->obj)->frequency(
+				t->base * exp2f(v * t->depth));
+			break;
+		  case TARGET_WAVEFORM_AMPLITUDE:
+			((AudioSynthWaveform *)t->obj)->amplitude(lin);
+			break;
+		  case TARGET_WAVEMOD_FREQUENCY:
+			((AudioSynthWaveformModulated *)t->obj)->frequency(
+				t->base * exp2f(v * t->depth));
+			break;
+		  case TARGET_WAVEMOD_AMPLITUDE:
+			((AudioSynthWaveformModulated *)t->obj)->amplitude(lin);
+			break;
+		  case TARGET_MIXER_GAIN:
+			((AudioMixer4 *)t->obj)->gain(t->channel, lin);
+			break;
+		  case TARGET_AMPLIFIER_GAIN:
+			((AudioAmplifier *)t->obj)->gain(lin);
+			break;
+		}
+	}
+}
+
+void AudioModulator::update(void)
+{
+	audio_block_t *block;
+	int16_t *p;
+	int32_t prev, next, inc, acc;
+	unsigned int i, j;
+
+	if (num_targets > 0) {
+		// parameters only need one new value per block
+		value = advance(AUDIO_BLOCK_SAMPLES);
+		apply(value);
+		return;
+	}
+	block = allocate();
+	if (!block) {
+		value = advance(AUDIO_BLOCK_SAMPLES);
+		return;
+	}
+	p = block->data;
+	prev = value * 32767.0f;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i += AUDIO_MODULATION_STEP) {
+		value = advance(AUDIO_MODULATION_STEP);
+		next = value * 32767.0f;
+		acc = prev << 8;
+		inc = ((next - prev) << 8) / AUDIO_MODULATION_STEP;
+		for (j=0; j < AUDIO_MODULATION_STEP; j++) {
+			acc += inc;
+			*p++ = acc >> 8;
+		}
+		prev = next;
+	}
+	transmit(block);
+	release(block);
+}
+
+
+float AudioModulatorLFO::advance(unsigned int samples)
+{
+	uint32_t ph, index, scale;
+	int32_t val1, val2;
+	float out;
+
+	ph = phase_accumulator + phase_increment * samples;
+	phase_accumulator = ph;
+	switch (tone_type) {
+	  case WAVEFORM_SINE:
+		index = ph >> 24;
+		val1 = AudioWaveformSine[index];
+		val2 = AudioWaveformSine[index+1];
+		scale = (ph >> 8) & 0xFFFF;
+		out = (float)(val1 + (((val2 - val1) * (int32_t)scale) >> 16))
+			* (1.0f / 32767.0f);
+		break;
+	  case WAVEFORM_SAWTOOTH:
+		out = (float)(int32_t)ph * (1.0f / 2147483648.0f);
+		break;
+	  case WAVEFORM_SAWTOOTH_REVERSE:
+		out = (float)(int32_t)ph * (-1.0f / 2147483648.0f);
+		break;
+	  case WAVEFORM_SQUARE:
+		out = (ph & 0x80000000) ? -1.0f : 1.0f;
+		break;
+	  case WAVEFORM_TRIANGLE:
+	  default:
+		// phase 0 starts at zero and rises, same as sine
+		ph += 0x40000000;
+		if (ph & 0x80000000) ph = ~ph;
+		out = (float)(int32_t)(ph - 0x40000000) * (1.0f / 1073741824.0f);
+		break;
+	}
+	return out * magnitude;
+}
+
+
+float AudioModulatorEnvelope::advance(unsigned int samples)
+{
+	float n = samples;
+
+	switch (state) {
+	  case STATE_ATTACK:
+		level += attack_step * n;
+		if (level >= 1.0f) {
+			level = 1.0f;
+			state = STATE_DECAY;
+		}
+		break;
+	  case STATE_DECAY:
+		level -= decay_step * n;
+		if (level <= sustain_level) {
+			level = sustain_level;
+			state = STATE_SUSTAIN;
+		}
+		break;
+	  case STATE_SUSTAIN:
+		level = sustain_level;
+		break;
+	  case STATE_RELEASE:
+		level -= release_rate * n;
+		if (level <= 0.0f) {
+			level = 0.0f;
+			state = STATE_IDLE;
+		}
+		break;
+	  default:
+		level = 0.0f;
+	}
+	return level;
+}
+
+
+float AudioModulatorRamp::advance(unsigned int samples)
+{
+	float n = level;
+	float t = target_level;
+	float d = rate * (float)samples;
+
+	if (n < t) {
+		n += d;
+		if (n > t) n = t;
+	} else if (n > t) {
+		n -= d;
+		if (n < t) n = t;
+	}
+	level = n;
+	return n;
+}
+
+
+void AudioModulatorSampleHold::update(void)
+{
+	input = receiveReadOnly(0);
+	position = 0;
+	AudioModulator::update();
+	if (input) {
+		release(input);
+		input = NULL;
+	}
+}
+
+// the input signal if connected, otherwise random numbers
+float AudioModulatorSampleHold::sample(void)
+{
+	if (input) {
+		unsigned int i = position;
+		if (i > 0) i--;
+		return (float)input->data[i] * (1.0f / 32768.0f);
+	}
+	seed = seed * 1103515245 + 12345;
+	return (float)(int32_t)seed * (1.0f / 2147483648.0f);
+}
+
+float AudioModulatorSampleHold::advance(unsigned int samples)
+{
+	uint32_t prior = phase_accumulator;
+	uint32_t inc = phase_increment * samples;
+
+	position += samples;
+	phase_accumulator = prior + inc;
+	if (triggered || phase_accumulator < prior) {
+		triggered = false;
+		held = sample();
+	}
+	return held;
+}
@@ -0,0 +1,260 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef synth_modulator_h_
+#define synth_modulator_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "filter_variable.h"
+#include "filter_ladder.h"
+#include "synth_waveform.h"
+#include "mixer.h"
+
+// Control rate modulation sources.  Rather than transmitting audio
+// blocks to another object's control input, these write directly to
+// up to 4 parameters (filter frequency, mixer gain, etc) once per
+// block.  With no parameters to modulate, they transmit an audio
+// block computed every AUDIO_MODULATION_STEP samples, linearly
+// interpolated, for objects which have modulation inputs.
+
+#define AUDIO_MODULATION_STEP  8
+#define AUDIO_MODULATION_TARGETS  4
+
+enum AudioModulationParameter {
+	MODULATE_FREQUENCY,
+	MODULATE_RESONANCE,
+	MODULATE_AMPLITUDE
+};
+
+class AudioModulator : public AudioStream
+{
+public:
+	AudioModulator(unsigned char ninput, audio_block_t **iqueue)
+	  : AudioStream(ninput, iqueue), num_targets(0), value(0.0f) {
+		// update even when not connected to any other object
+		active = true;
+	}
+	// Frequency: base * 2^(modulator * depth)  (depth in octaves)
+	// Others:    base + modulator * depth
+	bool modulate(AudioFilterStateVariable &f, AudioModulationParameter p,
+	  float base, float depth);
+	bool modulate(AudioFilterLadder &f, AudioModulationParameter p,
+	  float base, float depth);
+	bool modulate(AudioSynthWaveform &w, AudioModulationParameter p,
+	  float base, float depth);
+	bool modulate(AudioSynthWaveformModulated &w, AudioModulationParameter p,
+	  float base, float depth);
+	bool modulate(AudioMixer4 &m, unsigned int channel, float base, float depth);
+	bool modulate(AudioAmplifier &a, float base, float depth);
+	void clearTargets(void) {
+		__disable_irq();
+		num_targets = 0;
+		__enable_irq();
+	}
+	float read(void) {
+		return value;
+	}
+	virtual void update(void);
+protected:
+	// advance by a number of samples, return the new output (-1.0 to +1.0)
+	virtual float advance(unsigned int samples) = 0;
+private:
+	bool addTarget(AudioStream *obj, uint8_t kind, uint8_t channel,
+	  float base, float depth);
+	void apply(float v);
+	struct target_struct {
+		AudioStream *obj;
+		uint8_t kind;
+		uint8_t channel;
+		float base;
+		float depth;
+	};
+	struct target_struct target[AUDIO_MODULATION_TARGETS];
+	volatile uint8_t num_targets;
+	float value;
+};
+
+
+class AudioModulatorLFO : public AudioModulator
+{
+public:
+	AudioModulatorLFO(void) : AudioModulator(0, NULL), phase_accumulator(0),
+	  phase_increment(0), magnitude(1.0f), tone_type(WAVEFORM_SINE) {
+	}
+	void begin(short t_type) {
+		tone_type = t_type;
+	}
+	void frequency(float freq) {
+		if (freq < 0.0f) freq = 0.0f;
+		else if (freq > 1000.0f) freq = 1000.0f;
+		phase_increment = freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+	}
+	void amplitude(float n) {
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		magnitude = n;
+	}
+	void phase(float angle) {
+		if (angle < 0.0f || angle >= 360.0f) return;
+		__disable_irq();
+		phase_accumulator = angle * (float)(4294967296.0 / 360.0);
+		__enable_irq();
+	}
+protected:
+	virtual float advance(unsigned int samples);
+private:
+	uint32_t phase_accumulator;
+	uint32_t phase_increment;
+	float magnitude;
+	short tone_type;
+};
+
+
+class AudioModulatorEnvelope : public AudioModulator
+{
+public:
+	AudioModulatorEnvelope(void) : AudioModulator(0, NULL), state(STATE_IDLE),
+	  level(0.0f), release_rate(0.0f) {
+		attack(10.5f);
+		decay(35.0f);
+		sustain(0.5f);
+		release(300.0f);
+	}
+	void noteOn(void) {
+		__disable_irq();
+		state = STATE_ATTACK;
+		__enable_irq();
+	}
+	void noteOff(void) {
+		__disable_irq();
+		if (state != STATE_IDLE) {
+			state = STATE_RELEASE;
+			release_rate = release_step * level;
+		}
+		__enable_irq();
+	}
+	void attack(float milliseconds) {
+		attack_step = step(milliseconds);
+	}
+	void decay(float milliseconds) {
+		decay_step = step(milliseconds);
+	}
+	void sustain(float n) {
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		sustain_level = n;
+	}
+	void release(float milliseconds) {
+		release_step = step(milliseconds);
+	}
+	using AudioStream::release;
+	bool isActive(void) {
+		return state != STATE_IDLE;
+	}
+protected:
+	virtual float advance(unsigned int samples);
+private:
+	static float step(float milliseconds) {
+		float n = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+		if (n < 1.0f) n = 1.0f;
+		return 1.0f / n;
+	}
+	enum { STATE_IDLE, STATE_ATTACK, STATE_DECAY, STATE_SUSTAIN, STATE_RELEASE };
+	volatile uint8_t state;
+	float level;
+	float attack_step;
+	float decay_step;
+	float sustain_level;
+	float release_step;
+	float release_rate;
+};
+
+
+class AudioModulatorRamp : public AudioModulator
+{
+public:
+	AudioModulatorRamp(void) : AudioModulator(0, NULL), level(0.0f),
+	  target_level(0.0f), rate(0.0f) {
+	}
+	// move from the present level to a new level, in -1.0 to +1.0
+	void ramp(float n, float milliseconds) {
+		if (n < -1.0f) n = -1.0f;
+		else if (n > 1.0f) n = 1.0f;
+		float samples = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+		__disable_irq();
+		target_level = n;
+		rate = (samples < 1.0f) ? 2.0f : fabsf(n - level) / samples;
+		__enable_irq();
+	}
+	void amplitude(float n) {
+		ramp(n, 0.0f);
+	}
+	bool isRamping(void) {
+		return level != target_level;
+	}
+protected:
+	virtual float advance(unsigned int samples);
+private:
+	volatile float level;
+	volatile float target_level;
+	volatile float rate;
+};
+
+
+class AudioModulatorSampleHold : public AudioModulator
+{
+public:
+	AudioModulatorSampleHold(void) : AudioModulator(1, inputQueueArray),
+	  phase_accumulator(0), phase_increment(0), seed(1), held(0.0f),
+	  input(NULL), position(0), triggered(true) {
+	}
+	// take a new value this many times per second, 0 for trigger() only
+	void frequency(float freq) {
+		if (freq < 0.0f) freq = 0.0f;
+		else if (freq > 100.0f) freq = 100.0f;
+		phase_increment = freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+	}
+	// take a new value at the next update
+	void trigger(void) {
+		triggered = true;
+	}
+	virtual void update(void);
+protected:
+	virtual float advance(unsigned int samples);
+private:
+	float sample(void);
+	audio_block_t *inputQueueArray[1];
+	uint32_t phase_accumulator;
+	uint32_t phase_increment;
+	uint32_t seed;
+	float held;
+	audio_block_t *input;
+	unsigned int position;
+	volatile bool triggered;
+};
+
+#endif
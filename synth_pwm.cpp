@@ -27,6 +27,7 @@
 #include <Arduino.h>
 #include "synth_pwm.h"
 #include "utility/dspinst.h"
+#include "utility/inplace.h"
 
 
 #if defined(__ARM_ARCH_7EM__)
@@ -42,7 +43,7 @@ void AudioSynthWaveformPWM::update(void)
 		if (modinput) release(modinput);
 		return;
 	}
-	block = allocate();
+	block = inplace_output(modinput, allocate);
 	if (!block) {
 		// unable to allocate memory, so we'll send nothing
 		if (modinput) release(modinput);
@@ -73,7 +74,7 @@ void AudioSynthWaveformPWM::update(void)
 		}
 		elapsed = _elapsed;
 		magnitude = _magnitude;
-		release(modinput);
+		if (modinput != block) release(modinput);
 	} else {
 		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
 			elapsed += 65536;
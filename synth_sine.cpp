@@ -27,6 +27,7 @@
 #include <Arduino.h>
 #include "synth_sine.h"
 #include "utility/dspinst.h"
+#include "utility/inplace.h"
 
 // data_waveforms.c
 extern "C" {
@@ -150,7 +151,7 @@ void AudioSynthWaveformSineModulated::update(void)
 	modinput = receiveReadOnly();
 	ph = phase_accumulator;
 	inc = phase_increment;
-	block = allocate();
+	block = inplace_output(modinput, allocate);
 	if (!block) {
 		// unable to allocate memory, so we'll send nothing
 		if (modinput) {
@@ -168,6 +169,8 @@ void AudioSynthWaveformSineModulated::update(void)
 	}
 	if (modinput) {
 		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			// read before writing, block may be modinput
+			mod = modinput->data[i];
 			index = ph >> 24;
 			val1 = AudioWaveformSine[index];
 			val2 = AudioWaveformSine[index+1];
@@ -178,11 +181,10 @@ void AudioSynthWaveformSineModulated::update(void)
 			block->data[i] = multiply_32x32_rshift32(val1 + val2, magnitude);
 			// -32768 = no phase increment
 			// 32767 = double phase increment
-			mod = modinput->data[i];
 			ph += inc + (multiply_32x32_rshift32(inc, mod << 16) << 1);
 			//ph += inc + (((int64_t)inc * (mod << 16)) >> 31);
 		}
-		release(modinput);
+		if (modinput != block) release(modinput);
 	} else {
 		ph = phase_accumulator;
 		inc = phase_increment;
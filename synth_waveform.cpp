@@ -28,6 +28,7 @@
 #include "synth_waveform.h"
 #include "arm_math.h"
 #include "utility/dspinst.h"
+#include "utility/inplace.h"
 
 
 // uncomment for more accurate but more computationally expensive frequency modulation
@@ -36,30 +37,28 @@
 
 
 
-void AudioSynthWaveform::update(void)
+// Generate samples start to stop-1 of a block, using the current settings
+void AudioSynthWaveform::generate(int16_t *data, unsigned int start, unsigned int stop)
 {
-	audio_block_t *block;
-	int16_t *bp, *end;
+	int16_t *bp;
 	int32_t val1, val2;
 	int16_t magnitude15;
 	uint32_t i, ph, index, index2, scale;
 	const uint32_t inc = phase_increment;
 
 	ph = phase_accumulator + phase_offset;
-	if (magnitude == 0) {
-		phase_accumulator += inc * AUDIO_BLOCK_SAMPLES;
-		return;
-	}
-	block = allocate();
-	if (!block) {
-		phase_accumulator += inc * AUDIO_BLOCK_SAMPLES;
+	bp = data + start;
+	if (magnitude == 0 || (tone_type == WAVEFORM_ARBITRARY && !arbdata)) {
+		for (i=start; i < stop; i++) {
+			*bp++ = 0;
+		}
+		phase_accumulator += inc * (stop - start);
 		return;
 	}
-	bp = block->data;
 
 	switch(tone_type) {
 	case WAVEFORM_SINE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			index = ph >> 24;
 			val1 = AudioWaveformSine[index];
 			val2 = AudioWaveformSine[index+1];
@@ -72,13 +71,8 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_ARBITRARY:
-		if (!arbdata) {
-			release(block);
-			phase_accumulator += inc * AUDIO_BLOCK_SAMPLES;
-			return;
-		}
 		// len = 256
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			index = ph >> 24;
 			index2 = index + 1;
 			if (index2 >= 256) index2 = 0;
@@ -94,7 +88,7 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_SQUARE:
 		magnitude15 = signed_saturate_rshift(magnitude, 16, 1);
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			if (ph & 0x80000000) {
 				*bp++ = -magnitude15;
 			} else {
@@ -105,7 +99,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_BANDLIMIT_SQUARE:
-		for (int i = 0 ; i < AUDIO_BLOCK_SAMPLES ; i++)
+		for (i = start ; i < stop ; i++)
 		{
 		  uint32_t new_ph = ph + inc ;
 		  int16_t val = band_limit_waveform.generate_square (new_ph, i) ;
@@ -115,14 +109,14 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_SAWTOOTH:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			*bp++ = signed_multiply_32x16t(magnitude, ph);
 			ph += inc;
 		}
 		break;
 
 	case WAVEFORM_SAWTOOTH_REVERSE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			*bp++ = signed_multiply_32x16t(0xFFFFFFFFu - magnitude, ph);
 			ph += inc;
 		}
@@ -130,7 +124,7 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_BANDLIMIT_SAWTOOTH:
 	case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE:
-		for (i = 0 ; i < AUDIO_BLOCK_SAMPLES; i++)
+		for (i = start ; i < stop; i++)
 		{
 		  uint32_t new_ph = ph + inc ;
 		  int16_t val = band_limit_waveform.generate_sawtooth (new_ph, i) ;
@@ -143,7 +137,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_TRIANGLE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			uint32_t phtop = ph >> 30;
 			if (phtop == 1 || phtop == 2) {
 				*bp++ = ((0xFFFF - (ph >> 15)) * magnitude) >> 16;
@@ -158,7 +152,7 @@ void AudioSynthWaveform::update(void)
 		do {
 		uint32_t rise = 0xFFFFFFFF / (pulse_width >> 16);
 		uint32_t fall = 0xFFFFFFFF / (0xFFFF - (pulse_width >> 16));
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			if (ph < pulse_width/2) {
 				uint32_t n = (ph >> 16) * rise;
 				*bp++ = ((n >> 16) * magnitude) >> 16;
@@ -176,7 +170,7 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_PULSE:
 		magnitude15 = signed_saturate_rshift(magnitude, 16, 1);
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			if (ph < pulse_width) {
 				*bp++ = magnitude15;
 			} else {
@@ -187,7 +181,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_BANDLIMIT_PULSE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++)
+		for (i=start; i < stop; i++)
 		{
 		  int32_t new_ph = ph + inc ;
 		  int32_t val = band_limit_waveform.generate_pulse (new_ph, pulse_width, i) ;
@@ -197,7 +191,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_SAMPLE_HOLD:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < stop; i++) {
 			*bp++ = sample;
 			uint32_t newph = ph + inc;
 			if (newph < ph) {
@@ -208,6 +202,54 @@ void AudioSynthWaveform::update(void)
 		break;
 	}
 	phase_accumulator = ph - phase_offset;
+}
+
+void AudioSynthWaveform::apply_event(void)
+{
+	audio_event_t event;
+
+	events.read(&event);
+	if (event.type == EVENT_FREQUENCY) {
+		frequency(event.value);
+	} else {
+		amplitude(event.value);
+	}
+}
+
+void AudioSynthWaveform::update(void)
+{
+	audio_block_t *block;
+	int16_t *bp, *end;
+	int32_t val1;
+	unsigned int offset, start;
+
+	events.begin();
+	offset = events.next();
+	if (offset >= AUDIO_BLOCK_SAMPLES) {
+		if (magnitude == 0 || (tone_type == WAVEFORM_ARBITRARY && !arbdata)) {
+			phase_accumulator += phase_increment * AUDIO_BLOCK_SAMPLES;
+			return;
+		}
+	}
+	block = allocate();
+	if (!block) {
+		while (offset < AUDIO_BLOCK_SAMPLES) {
+			apply_event();
+			offset = events.next();
+		}
+		phase_accumulator += phase_increment * AUDIO_BLOCK_SAMPLES;
+		return;
+	}
+	start = 0;
+	while (1) {
+		generate(block->data, start, offset);
+		if (offset >= AUDIO_BLOCK_SAMPLES) break;
+		// a frequency or amplitude change at this sample
+		apply_event();
+		start = offset;
+		offset = events.next();
+		if (offset < start) offset = start;
+	}
 
 	if (tone_offset) {
 		bp = block->data;
@@ -274,7 +316,6 @@ void AudioSynthWaveformModulated::update(void)
 			}
 			phasedata[i] = ph;
 		}
-		release(moddata);
 	} else if (moddata) {
 		// Phase Modulation
 		bp = moddata->data;
@@ -284,7 +325,6 @@ void AudioSynthWaveformModulated::update(void)
 			phasedata[i] = ph + n;
 			ph += inc;
 		}
-		release(moddata);
 	} else {
 		// No Modulation Input
 		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
@@ -296,10 +336,14 @@ void AudioSynthWaveformModulated::update(void)
 
 	// If the amplitude is zero, no output, but phase still increments properly
 	if (magnitude == 0) {
+		if (moddata) release(moddata);
 		if (shapedata) release(shapedata);
 		return;
 	}
-	block = allocate();
+	// The modulation is fully consumed into phasedata, so its block
+	// may be reused for the output
+	block = inplace_output(moddata, allocate);
+	if (moddata && moddata != block) release(moddata);
 	if (!block) {
 		if (shapedata) release(shapedata);
 		return;
@@ -30,6 +30,7 @@
 #include <Arduino.h>
 #include "AudioStream.h"
 #include "arm_math.h"
+#include "utility/event_queue.h"
 
 // waveforms.c
 extern "C" {
@@ -113,6 +114,13 @@ public:
 		phase_increment = freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
 		if (phase_increment > 0x7FFE0000u) phase_increment = 0x7FFE0000;
 	}
+	// change frequency or amplitude at an exact sample, see AudioEventTime()
+	bool frequency(float freq, uint32_t time) {
+		return events.add(time, EVENT_FREQUENCY, 0, freq);
+	}
+	bool amplitude(float n, uint32_t time) {
+		return events.add(time, EVENT_AMPLITUDE, 0, n);
+	}
 	void phase(float angle) {
 		if (angle < 0.0f) {
 			angle = 0.0;
@@ -168,6 +176,9 @@ public:
 	virtual void update(void);
 
 private:
+	enum { EVENT_FREQUENCY, EVENT_AMPLITUDE };
+	void generate(int16_t *data, unsigned int start, unsigned int stop);
+	void apply_event(void);
 	uint32_t phase_accumulator;
 	uint32_t phase_increment;
 	uint32_t phase_offset;
@@ -178,6 +189,7 @@ private:
 	short    tone_type;
 	int16_t  tone_offset;
         BandLimitedWaveform band_limit_waveform ;
+	AudioEventQueue events;
 };
 
 
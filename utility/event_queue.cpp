@@ -0,0 +1,54 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "event_queue.h"
+
+uint16_t AudioEventQueue::num_queues = 0;
+uint16_t AudioEventQueue::last_index = 0;
+volatile uint32_t AudioEventQueue::now = 0;
+
+bool AudioEventQueue::add(uint32_t time, uint8_t type, uint8_t channel, float value)
+{
+	uint32_t h, n;
+
+	if (!buffer) {
+		buffer = (audio_event_t *)malloc(AUDIO_EVENT_QUEUE_SIZE * sizeof(audio_event_t));
+		if (!buffer) return false;
+	}
+	h = head;
+	n = h + 1;
+	if (n >= AUDIO_EVENT_QUEUE_SIZE) n = 0;
+	if (n == tail) return false; // queue is full
+	buffer[h].time = time;
+	buffer[h].value = value;
+	buffer[h].type = type;
+	buffer[h].channel = channel;
+	// the event must be complete before update() can see the new head
+	asm volatile("" ::: "memory");
+	head = n;
+	return true;
+}
@@ -0,0 +1,110 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef event_queue_h_
+#define event_queue_h_
+
+#include "AudioStream.h"
+
+// Timed parameter changes.  Normally a setting takes effect at the start
+// of the next audio block, up to 2.9 ms after the function was called.
+// Objects with timed functions, like envelope.noteOn(time), instead queue
+// the change and apply it at that exact sample, splitting their update at
+// each event.
+//
+// Time is counted in samples.  AudioEventTime() is the first sample of the
+// most recent audio block, so AudioEventTime() + AUDIO_BLOCK_SAMPLES is the
+// earliest time which is certain to be exact when called from loop().
+// Events already in the past happen at the start of the next block.
+//
+// Each queue has a single producer and a single consumer, so adding
+// events never disables interrupts.  Timed functions for any one object
+// must be called from only one place (either the main program, or one
+// other object's update), with times in increasing order.  The first
+// event allocates the queue's memory, so it must not be added from an
+// update.
+//
+// There is no sample counter within AudioStream.  Each queue is given an
+// index as its object is created, which is also the order of the update
+// list, so the clock advances whenever a queue sees an index which is not
+// larger than the last.  It can only go wrong (by one block) in the update
+// when connections make objects with queues become active or inactive.
+
+#ifndef AUDIO_EVENT_QUEUE_SIZE
+#define AUDIO_EVENT_QUEUE_SIZE  16
+#endif
+
+typedef struct audio_event_struct {
+	uint32_t time;
+	float    value;
+	uint8_t  type;
+	uint8_t  channel;
+} audio_event_t;
+
+class AudioEventQueue
+{
+public:
+	AudioEventQueue(void) : buffer(NULL), head(0), tail(0) {
+		index = ++num_queues;
+	}
+	// called by the main program, through an object's timed functions
+	bool add(uint32_t time, uint8_t type, uint8_t channel, float value);
+	// called at the start of every update, before any early return
+	void begin(void) {
+		if (index <= last_index) now += AUDIO_BLOCK_SAMPLES;
+		last_index = index;
+	}
+	// sample offset of the next event in this block, or
+	// AUDIO_BLOCK_SAMPLES when no more events happen within it
+	unsigned int next(void) {
+		uint32_t t = tail;
+		if (t == head) return AUDIO_BLOCK_SAMPLES;
+		int32_t offset = buffer[t].time - now;
+		if (offset <= 0) return 0;
+		if (offset >= AUDIO_BLOCK_SAMPLES) return AUDIO_BLOCK_SAMPLES;
+		return offset;
+	}
+	// remove the event found by next()
+	void read(audio_event_t *event) {
+		uint32_t t = tail;
+		*event = buffer[t];
+		if (++t >= AUDIO_EVENT_QUEUE_SIZE) t = 0;
+		tail = t;
+	}
+	static uint32_t time(void) { return now; }
+private:
+	audio_event_t *buffer;
+	volatile uint8_t head;
+	volatile uint8_t tail;
+	uint16_t index;
+	static uint16_t num_queues;
+	static uint16_t last_index;
+	static volatile uint32_t now;
+};
+
+#define AudioEventTime() (AudioEventQueue::time())
+
+#endif
@@ -0,0 +1,80 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef inplace_h_
+#define inplace_h_
+
+#include "AudioStream.h"
+
+// Most effects read one block and write another.  When the input block
+// is not shared with any other object (ref_count is 1), nothing else can
+// see it, so the output may simply overwrite it.  This saves an allocate()
+// and, compared to receiveWritable(), the copy which is made when the
+// block happens to be shared.
+//
+// inplace_output() returns the input block itself when it may be written,
+// or a newly allocated block (or NULL) otherwise.  The caller always
+// releases the returned block after transmit, and additionally releases
+// the input when a different block was returned.  A NULL input simply
+// allocates.  Objects pass their own inherited allocate function, which
+// is protected within AudioStream.
+//
+// Processing must read each input sample before writing the same output
+// sample, which is true of nearly all per-sample loops.
+//
+// writable_output() is the same, for objects which used receiveWritable()
+// before.  Those never allocated for an unshared block, so reusing it is
+// not counted by AudioMemoryInPlace().
+
+extern volatile uint32_t audio_inplace_count;
+
+static inline audio_block_t * inplace_output(audio_block_t *in,
+	audio_block_t * (*alloc)(void)) __attribute__((always_inline, unused));
+static inline audio_block_t * inplace_output(audio_block_t *in,
+	audio_block_t * (*alloc)(void))
+{
+	if (in && in->ref_count == 1) {
+		audio_inplace_count++;
+		return in;
+	}
+	return alloc();
+}
+
+static inline audio_block_t * writable_output(audio_block_t *in,
+	audio_block_t * (*alloc)(void)) __attribute__((always_inline, unused));
+static inline audio_block_t * writable_output(audio_block_t *in,
+	audio_block_t * (*alloc)(void))
+{
+	if (in && in->ref_count == 1) return in;
+	return alloc();
+}
+
+// Number of allocations avoided by in place processing, for profiling.
+// Only objects which always allocated their output block before count.
+#define AudioMemoryInPlace() (audio_inplace_count)
+#define AudioMemoryInPlaceReset() (audio_inplace_count = 0)
+
+#endif
@@ -0,0 +1,92 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef memory_account_h_
+#define memory_account_h_
+
+#include "AudioStream.h"
+
+// AudioMemoryUsage() tells how many audio blocks are in use, but not
+// which objects have them.  Objects which inherit AudioMemoryAccount
+// count the blocks they hold, the most they have ever held at once, and
+// the number of times allocate() failed, which is when they drop audio.
+//
+//   Serial.print(delay1.memoryUsage());
+//   Serial.print(delay1.memoryUsageMax());
+//   Serial.print(delay1.memoryFailures());
+//
+// Between updates, any block in use is either held by an object (most
+// are counted by accounts, some like the outputs and queues are not), or
+// waiting in a connection.  That total stays nearly the same while audio
+// runs, so AudioMemoryUnaccounted() which keeps growing means some object
+// never releases its blocks.
+//
+// The counts are changed only by update(), so they may be read at any
+// time without disabling interrupts.
+
+class AudioMemoryAccount
+{
+public:
+	AudioMemoryAccount(void) : account_used(0), account_used_max(0),
+	  account_failed(0) {
+		account_next = account_first;
+		account_first = this;
+	}
+	unsigned int memoryUsage(void) { return account_used; }
+	unsigned int memoryUsageMax(void) { return account_used_max; }
+	void memoryUsageMaxReset(void) { account_used_max = account_used; }
+	uint32_t memoryFailures(void) { return account_failed; }
+	// blocks in use, but not held by any account
+	static int unaccounted(void);
+protected:
+	// a block received or allocated, which may be NULL if allocate() failed
+	audio_block_t * account_add(audio_block_t *block) {
+		if (block) {
+			uint32_t n = account_used + 1;
+			account_used = n;
+			if (n > account_used_max) account_used_max = n;
+		}
+		return block;
+	}
+	audio_block_t * account_allocate(audio_block_t *block) {
+		if (!block) account_failed++;
+		return account_add(block);
+	}
+	// call after releasing (or transmitting and releasing) a counted block
+	void account_remove(void) {
+		if (account_used > 0) account_used--;
+	}
+private:
+	volatile uint16_t account_used;
+	volatile uint16_t account_used_max;
+	volatile uint32_t account_failed;
+	AudioMemoryAccount *account_next;
+	static AudioMemoryAccount *account_first;
+};
+
+#define AudioMemoryUnaccounted() (AudioMemoryAccount::unaccounted())
+
+#endif
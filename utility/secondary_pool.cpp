@@ -0,0 +1,53 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "secondary_pool.h"
+
+volatile uint32_t AudioSecondaryPool::usage = 0;
+volatile uint32_t AudioSecondaryPool::usage_max = 0;
+audio_block_t * AudioSecondaryPool::free_list = NULL;
+audio_block_t * AudioSecondaryPool::pool = NULL;
+audio_block_t * AudioSecondaryPool::pool_end = NULL;
+
+// Call once, from setup().  Free blocks are linked through their data,
+// so no other memory is needed, even for a large PSRAM pool.
+void AudioSecondaryPool::initialize(audio_block_t *data, unsigned int num)
+{
+	audio_block_t *list = NULL;
+	unsigned int i;
+
+	if (pool) return;
+	for (i=num; i > 0; i--) {
+		memcpy(data[i-1].data, &list, sizeof(list));
+		list = &data[i-1];
+	}
+	__disable_irq();
+	free_list = list;
+	pool = data;
+	pool_end = data + num;
+	__enable_irq();
+}
@@ -0,0 +1,87 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef secondary_pool_h_
+#define secondary_pool_h_
+
+#include <string.h>
+#include "AudioStream.h"
+
+// A second pool of audio blocks, for objects which keep a long history
+// of the signal.  With AudioMemorySecondary(), AudioEffectDelay copies
+// its input into these blocks, so a long delay no longer takes hundreds
+// of blocks from AudioMemory(), and the main pool can be sized only for
+// the blocks which move between objects.
+//
+// The blocks are placed in DMAMEM (the second RAM on Teensy 4, which is
+// also where AudioMemory() is).  On Teensy 4.1 with PSRAM chips, put
+//   #define AUDIO_SECONDARY_MEMORY EXTMEM
+// before #include <Audio.h> to use the PSRAM instead.
+//
+// These blocks are never transmitted or given to release().  Only the
+// object which allocated one uses it, and only from its update.
+
+#ifndef AUDIO_SECONDARY_MEMORY
+#define AUDIO_SECONDARY_MEMORY DMAMEM
+#endif
+
+#define AudioMemorySecondary(num) ({ \
+	static AUDIO_SECONDARY_MEMORY audio_block_t data[num]; \
+	AudioSecondaryPool::initialize(data, num); \
+})
+#define AudioMemorySecondaryUsage() (AudioSecondaryPool::usage)
+#define AudioMemorySecondaryUsageMax() (AudioSecondaryPool::usage_max)
+#define AudioMemorySecondaryUsageMaxReset() (AudioSecondaryPool::usage_max = AudioSecondaryPool::usage)
+
+class AudioSecondaryPool
+{
+public:
+	static void initialize(audio_block_t *data, unsigned int num);
+	// called only from updates
+	static audio_block_t * allocate(void) {
+		audio_block_t *block = free_list;
+		if (!block) return NULL;
+		memcpy(&free_list, block->data, sizeof(free_list));
+		if (++usage > usage_max) usage_max = usage;
+		return block;
+	}
+	static void release(audio_block_t *block) {
+		memcpy(block->data, &free_list, sizeof(free_list));
+		free_list = block;
+		usage--;
+	}
+	static bool contains(const audio_block_t *block) {
+		return block >= pool && block < pool_end;
+	}
+	static volatile uint32_t usage;
+	static volatile uint32_t usage_max;
+private:
+	static audio_block_t *free_list;
+	static audio_block_t *pool;
+	static audio_block_t *pool_end;
+};
+
+#endif
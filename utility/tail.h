@@ -0,0 +1,58 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef tail_h_
+#define tail_h_
+
+#include "AudioStream.h"
+
+// Objects with a tail (reverbs, recursive filters) keep producing sound
+// after their input stops.  When receive returns NULL they process silence
+// instead, until their output has stayed within a small threshold for
+// enough consecutive blocks to flush all their internal delays.  Then, like
+// every other object without input, they transmit nothing and cost almost
+// no CPU until input returns.  The remaining state is below the threshold,
+// so it is simply left in place.
+//
+// Reverbs count consecutive quiet blocks in tail_count, which starts at
+// (and stops at) their TAIL_BLOCKS limit and is zeroed whenever input
+// arrives.  Fixed point recursive filters may settle into a small limit
+// cycle instead of silence, so AudioFilterBiquad runs for the decay time
+// computed from its coefficients, or until its output reaches zero, and
+// then clears its state.
+
+static inline bool tail_quiet(const int16_t *data, int32_t threshold) __attribute__((always_inline, unused));
+static inline bool tail_quiet(const int16_t *data, int32_t threshold)
+{
+	const int16_t *end = data + AUDIO_BLOCK_SAMPLES;
+	do {
+		int32_t n = *data++;
+		if (n > threshold || n < -threshold) return false;
+	} while (data < end);
+	return true;
+}
+
+#endif
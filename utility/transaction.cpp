@@ -0,0 +1,104 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "transaction.h"
+
+AudioTransaction * AudioTransaction::first = NULL;
+void (*AudioTransaction::update_isr)(void) = NULL;
+
+AudioTransaction::AudioTransaction(void) : filling(0), committed(NULL)
+{
+	batch[0].count = 0;
+	batch[1].count = 0;
+	__disable_irq();
+	next = first;
+	first = this;
+	__enable_irq();
+}
+
+audio_transaction_call_t * AudioTransaction::add(
+  void (*call)(audio_transaction_call_t *c), void *object)
+{
+	batch_struct *b = &batch[filling];
+	audio_transaction_call_t *c;
+
+	if (b->count >= AUDIO_TRANSACTION_SIZE) return NULL;
+	c = &b->call[b->count++];
+	c->call = call;
+	c->object = object;
+	return c;
+}
+
+bool AudioTransaction::commit(void)
+{
+	batch_struct *b = &batch[filling];
+
+	install();
+	if (b->count == 0) return true;
+	if (committed) return false; // previous batch not applied yet
+	// the calls must be complete before the update can see them
+	asm volatile("" ::: "memory");
+	committed = b;
+	filling ^= 1;
+	return true;
+}
+
+// runs at the start of the update, with the main program interrupted
+void AudioTransaction::apply(void)
+{
+	batch_struct *b = committed;
+	unsigned int i;
+
+	if (!b) return;
+	for (i=0; i < b->count; i++) {
+		b->call[i].call(&b->call[i]);
+	}
+	b->count = 0;
+	committed = NULL;
+}
+
+// AudioMemory() sets the software interrupt to run the update list.
+// Put this function in front of it, or back if AudioMemory() has
+// replaced it again.
+void AudioTransaction::install(void)
+{
+	void (*isr)(void) = _VectorsRam[IRQ_SOFTWARE + 16];
+
+	if (isr == software_isr) return;
+	update_isr = isr;
+	attachInterruptVector(IRQ_SOFTWARE, software_isr);
+}
+
+void AudioTransaction::software_isr(void)
+{
+	AudioTransaction *t;
+
+	for (t = first; t; t = t->next) {
+		t->apply();
+	}
+	update_isr();
+}
@@ -0,0 +1,194 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2021, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef transaction_h_
+#define transaction_h_
+
+#include <string.h>
+#include "AudioStream.h"
+
+// Changes to several objects which must take effect together.  The usual
+// way is AudioNoInterrupts() before the changes and AudioInterrupts()
+// after, but that holds off the entire audio update for as long as the
+// main program takes, which can cause dropouts.  A transaction instead
+// records each function call, and commit() hands the whole batch to the
+// audio library, which makes all the calls at the start of its next
+// update, before any object runs.  Interrupts are never disabled.
+//
+//   AudioTransaction changes;
+//
+//   changes.set(mixer1, &AudioMixer4::gain, 0, 0.8);
+//   changes.set(playMem1, &AudioPlayMemory::play, AudioSampleSnare);
+//   changes.set(envelope1, &AudioEffectEnvelope::noteOn);
+//   changes.commit();
+//
+// Create transactions as global objects, like the audio objects, since
+// the update keeps a list of them.  Any function returning void with up
+// to 3 arguments may be used.  The calls run from the audio interrupt, so
+// they must be quick, and must not use hardware (for example, the SGTL5000
+// control functions).
+//
+// commit() returns false while the previous batch is still waiting for an
+// update.  The calls stay recorded, so more may be added and commit() tried
+// again.  set() returns false when AUDIO_TRANSACTION_SIZE calls are waiting.
+//
+// The audio update is started by the IRQ_SOFTWARE interrupt.  The first
+// commit() after AudioMemory() installs a handler for that interrupt which
+// makes the calls and then runs the library's normal update.
+
+#ifndef AUDIO_TRANSACTION_SIZE
+#define AUDIO_TRANSACTION_SIZE  16
+#endif
+
+typedef struct audio_transaction_call_struct {
+	void (*call)(struct audio_transaction_call_struct *c);
+	void *object;
+	// the member function pointer, followed by the arguments
+	unsigned char data[sizeof(void (AudioStream::*)(void)) + 3 * sizeof(uint32_t)];
+} audio_transaction_call_t;
+
+// keeps the arguments from taking part in template argument deduction,
+// so constants like 0 or 0.8 convert to the function's parameter types
+template <typename T> struct audio_transaction_arg { typedef T type; };
+
+class AudioTransaction
+{
+public:
+	AudioTransaction(void);
+	template <typename T, typename C>
+	bool set(T &object, void (C::*method)(void)) {
+		audio_transaction_call_t *c = add(&call0<C>, static_cast<C *>(&object));
+		if (!c) return false;
+		memcpy(c->data, &method, sizeof(method));
+		return true;
+	}
+	template <typename T, typename C, typename A>
+	bool set(T &object, void (C::*method)(A),
+	  typename audio_transaction_arg<A>::type a) {
+		static_assert(sizeof(method) + sizeof(A) <= c_data,
+		  "arguments too large for AudioTransaction");
+		audio_transaction_call_t *c = add(&call1<C, A>, static_cast<C *>(&object));
+		if (!c) return false;
+		memcpy(c->data, &method, sizeof(method));
+		memcpy(c->data + sizeof(method), &a, sizeof(A));
+		return true;
+	}
+	template <typename T, typename C, typename A, typename B>
+	bool set(T &object, void (C::*method)(A, B),
+	  typename audio_transaction_arg<A>::type a,
+	  typename audio_transaction_arg<B>::type b) {
+		static_assert(sizeof(method) + sizeof(A) + sizeof(B) <= c_data,
+		  "arguments too large for AudioTransaction");
+		audio_transaction_call_t *c = add(&call2<C, A, B>, static_cast<C *>(&object));
+		if (!c) return false;
+		unsigned char *p = c->data;
+		memcpy(p, &method, sizeof(method));
+		p += sizeof(method);
+		memcpy(p, &a, sizeof(A));
+		memcpy(p + sizeof(A), &b, sizeof(B));
+		return true;
+	}
+	template <typename T, typename C, typename A, typename B, typename D>
+	bool set(T &object, void (C::*method)(A, B, D),
+	  typename audio_transaction_arg<A>::type a,
+	  typename audio_transaction_arg<B>::type b,
+	  typename audio_transaction_arg<D>::type d) {
+		static_assert(sizeof(method) + sizeof(A) + sizeof(B) + sizeof(D)
+		  <= c_data, "arguments too large for AudioTransaction");
+		audio_transaction_call_t *c = add(&call3<C, A, B, D>, static_cast<C *>(&object));
+		if (!c) return false;
+		unsigned char *p = c->data;
+		memcpy(p, &method, sizeof(method));
+		p += sizeof(method);
+		memcpy(p, &a, sizeof(A));
+		memcpy(p + sizeof(A), &b, sizeof(B));
+		memcpy(p + sizeof(A) + sizeof(B), &d, sizeof(D));
+		return true;
+	}
+	bool commit(void);
+	// true until the last committed batch has been applied
+	bool busy(void) { return committed != NULL; }
+	// forget calls which have not been committed
+	void clear(void) { batch[filling].count = 0; }
+private:
+	struct batch_struct {
+		audio_transaction_call_t call[AUDIO_TRANSACTION_SIZE];
+		uint8_t count;
+	};
+	static const unsigned int c_data = sizeof(audio_transaction_call_t::data);
+	audio_transaction_call_t * add(void (*call)(audio_transaction_call_t *c), void *object);
+	void apply(void);
+	static void install(void);
+	static void software_isr(void);
+	template <typename C>
+	static void call0(audio_transaction_call_t *c) {
+		void (C::*method)(void);
+		memcpy(&method, c->data, sizeof(method));
+		(static_cast<C *>(c->object)->*method)();
+	}
+	template <typename C, typename A>
+	static void call1(audio_transaction_call_t *c) {
+		void (C::*method)(A);
+		A a;
+		memcpy(&method, c->data, sizeof(method));
+		memcpy(&a, c->data + sizeof(method), sizeof(A));
+		(static_cast<C *>(c->object)->*method)(a);
+	}
+	template <typename C, typename A, typename B>
+	static void call2(audio_transaction_call_t *c) {
+		void (C::*method)(A, B);
+		A a;
+		B b;
+		const unsigned char *p = c->data;
+		memcpy(&method, p, sizeof(method));
+		p += sizeof(method);
+		memcpy(&a, p, sizeof(A));
+		memcpy(&b, p + sizeof(A), sizeof(B));
+		(static_cast<C *>(c->object)->*method)(a, b);
+	}
+	template <typename C, typename A, typename B, typename D>
+	static void call3(audio_transaction_call_t *c) {
+		void (C::*method)(A, B, D);
+		A a;
+		B b;
+		D d;
+		const unsigned char *p = c->data;
+		memcpy(&method, p, sizeof(method));
+		p += sizeof(method);
+		memcpy(&a, p, sizeof(A));
+		memcpy(&b, p + sizeof(A), sizeof(B));
+		memcpy(&d, p + sizeof(A) + sizeof(B), sizeof(D));
+		(static_cast<C *>(c->object)->*method)(a, b, d);
+	}
+	batch_struct batch[2];
+	uint8_t filling;			// batch being recorded by set()
+	batch_struct * volatile committed;	// batch waiting for the update
+	AudioTransaction *next;
+	static AudioTransaction *first;
+	static void (*update_isr)(void);
+};
+
+#endif